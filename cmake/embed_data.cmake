@@ -0,0 +1,59 @@
+# Author: watsonryan
+# Purpose: Script-mode generator converting the HWM14 data files into constexpr byte tables.
+#
+# Usage: cmake -DOUTPUT=<file.cpp> -DHWM_BIN=<path> -DDWM_DAT=<path> -DGD2QD_DAT=<path> -P embed_data.cmake
+
+foreach(var OUTPUT HWM_BIN DWM_DAT GD2QD_DAT)
+  if(NOT DEFINED ${var})
+    message(FATAL_ERROR "embed_data.cmake: ${var} is required")
+  endif()
+endforeach()
+
+# Emits `alignas(64) constexpr unsigned char <name>[] = {...};` into <out_var>.
+function(hwm14_embed_array path name out_var)
+  file(READ "${path}" hex HEX)
+  string(LENGTH "${hex}" hex_len)
+  math(EXPR size "${hex_len} / 2")
+  string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," body "${hex}")
+  # Break the initializer into lines of 16 bytes to keep the generated file diff/grep friendly.
+  string(REGEX REPLACE "((0x[0-9a-f][0-9a-f],){16})" "\\1\n    " body "${body}")
+  set(${out_var} "alignas(64) constexpr unsigned char ${name}[${size}] = {\n    ${body}\n};\n" PARENT_SCOPE)
+endfunction()
+
+hwm14_embed_array("${HWM_BIN}" kHwmBin hwm_decl)
+hwm14_embed_array("${DWM_DAT}" kDwmDat dwm_decl)
+hwm14_embed_array("${GD2QD_DAT}" kGd2qdDat gd2qd_decl)
+
+file(WRITE "${OUTPUT}.tmp" "// Generated by cmake/embed_data.cmake -- do not edit.
+
+#include \"hwm14/detail/embedded_data.hpp\"
+
+namespace hwm14::detail {
+
+namespace {
+
+${hwm_decl}
+${dwm_decl}
+${gd2qd_decl}
+std::span<const std::byte> AsBytes(const unsigned char* p, std::size_t n) {
+  return {reinterpret_cast<const std::byte*>(p), n};
+}
+
+}  // namespace
+
+std::span<const std::byte> EmbeddedHwmBin() {
+  return AsBytes(kHwmBin, sizeof(kHwmBin));
+}
+
+std::span<const std::byte> EmbeddedDwmDat() {
+  return AsBytes(kDwmDat, sizeof(kDwmDat));
+}
+
+std::span<const std::byte> EmbeddedGd2qdDat() {
+  return AsBytes(kGd2qdDat, sizeof(kGd2qdDat));
+}
+
+}  // namespace hwm14::detail
+")
+file(COPY_FILE "${OUTPUT}.tmp" "${OUTPUT}" ONLY_IF_DIFFERENT)
+file(REMOVE "${OUTPUT}.tmp")
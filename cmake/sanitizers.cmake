@@ -9,6 +9,16 @@ function(hwm14_apply_strict_fp_flags target_name)
   endif()
 endfunction()
 
+# Relaxed FP for the kernel copy selected by `Options::strict_fp = false`; source options are appended
+# after the target's strict flags, so these win for that file only. MSVC relaxes the file with pragmas
+# instead, since a second /fp: option only draws warning D9025.
+function(hwm14_apply_fast_fp_source_flags source_file)
+  if(NOT MSVC)
+    set_source_files_properties(${source_file} PROPERTIES COMPILE_OPTIONS
+      "-ffp-contract=fast;-fassociative-math;-fno-signed-zeros;-fno-trapping-math")
+  endif()
+endfunction()
+
 function(hwm14_apply_runtime_flags target_name)
   if(HWM14_ENABLE_PROFILE)
     if(MSVC)
@@ -0,0 +1,45 @@
+// Author: watsonryan
+// Purpose: Build a precompiled model blob from a data directory, or time loading an existing blob.
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+#include "hwm14/hwm14.hpp"
+#include "hwm14/logging.hpp"
+
+int main(int argc, char** argv) {
+  const auto log = hwm14::MakeStderrLogSink();
+
+  if (argc == 3 && std::string_view(argv[1]) == "--check") {
+    const auto t0 = std::chrono::steady_clock::now();
+    auto model = hwm14::Model::LoadFromBlob(argv[2]);
+    const auto t1 = std::chrono::steady_clock::now();
+    if (!model) {
+      hwm14::LogError(log, "blob load failed", model.error());
+      return EXIT_FAILURE;
+    }
+    std::cout << "load_us=" << std::chrono::duration<double, std::micro>(t1 - t0).count() << "\n";
+    return EXIT_SUCCESS;
+  }
+
+  if (argc != 3) {
+    hwm14::Log(log, hwm14::LogLevel::kError, "usage: hwm14_blob_cli <data_dir> <out.blob> | --check <blob>");
+    return EXIT_FAILURE;
+  }
+
+  auto model = hwm14::Model::LoadFromDirectory(argv[1]);
+  if (!model) {
+    hwm14::LogError(log, "model load failed", model.error());
+    return EXIT_FAILURE;
+  }
+
+  const auto written = model.value().SaveBlob(argv[2]);
+  if (!written) {
+    hwm14::LogError(log, "blob write failed", written.error());
+    return EXIT_FAILURE;
+  }
+  std::cout << "bytes=" << written.value() << "\n";
+  return EXIT_SUCCESS;
+}
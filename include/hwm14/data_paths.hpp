@@ -7,6 +7,7 @@
 // Author: watsonryan
 // Purpose: Runtime data path resolution for HWM14 coefficient files.
 
+#include <cstdint>
 #include <filesystem>
 
 #include "hwm14/error.hpp"
@@ -25,11 +26,31 @@ struct DataPaths {
   std::filesystem::path gd2qd_dat;
 };
 
+/** @brief Cheap identity of one data file: canonical path, size, and last write time. */
+struct DataFileIdentity {
+  std::filesystem::path canonical{};
+  std::uintmax_t size{};
+  std::filesystem::file_time_type mtime{};
+
+  friend bool operator==(const DataFileIdentity&, const DataFileIdentity&) = default;
+};
+
+/** @brief Identities of the three files of a `DataPaths`; equal identities are treated as equal contents. */
+struct DataPathsIdentity {
+  DataFileIdentity hwm_bin{};
+  DataFileIdentity dwm_dat{};
+  DataFileIdentity gd2qd_dat{};
+
+  friend bool operator==(const DataPathsIdentity&, const DataPathsIdentity&) = default;
+};
+
 /** @brief Resolve required files from a caller-provided directory. */
 [[nodiscard]] Result<DataPaths, Error> ResolveDataPathsFromDirectory(const std::filesystem::path& data_dir);
 /** @brief Resolve required files from search paths (cwd, options, env). */
 [[nodiscard]] Result<DataPaths, Error> ResolveDataPathsWithSearchPaths(const Options& options);
 /** @brief Resolve required files using options/default policy. */
 [[nodiscard]] Result<DataPaths, Error> ResolveDataPaths(const Options& options);
+/** @brief Stat the files of `paths` without reading them; fails if any cannot be canonicalized or stat'ed. */
+[[nodiscard]] Result<DataPathsIdentity, Error> IdentifyDataFiles(const DataPaths& paths);
 
 }  // namespace hwm14
@@ -0,0 +1,22 @@
+/**
+ * @file cubic_weights.hpp
+ * @brief Internal Catmull-Rom stencil weights shared by the QD lookup grid and quiet surrogates.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Cubic interpolation weights for uniform lattices.
+
+#include <array>
+
+namespace hwm14::detail {
+
+/** @brief Catmull-Rom weights of stencil points -1, 0, 1, 2 at fraction `t` of the central interval. */
+inline std::array<double, 4> CubicWeights(double t) {
+  const double t2 = t * t;
+  const double t3 = t2 * t;
+  return {0.5 * (-t3 + 2.0 * t2 - t), 0.5 * (3.0 * t3 - 5.0 * t2 + 2.0), 0.5 * (-3.0 * t3 + 4.0 * t2 + t),
+          0.5 * (t3 - t2)};
+}
+
+}  // namespace hwm14::detail
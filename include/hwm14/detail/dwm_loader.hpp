@@ -7,8 +7,11 @@
 // Author: watsonryan
 // Purpose: Loader for dwm07b104i.dat disturbance wind coefficients.
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <span>
+#include <string_view>
 #include <vector>
 
 #include "hwm14/error.hpp"
@@ -26,7 +29,24 @@ struct DwmData {
   float twidth{};
 };
 
+/** @brief Sentinel in `DwmData::termarr_flat` marking an absent factor. */
+inline constexpr std::int32_t kDwmNoTerm = 999;
+
+/** @brief Number of vector spherical harmonic terms the DWM basis produces for `(nmax, mmax)`. */
+[[nodiscard]] constexpr int DwmVshTermCount(int nmax, int mmax) {
+  return ((((nmax + 1) * (nmax + 2) - (nmax - mmax) * (nmax - mmax + 1)) / 2) - 1) * 4 - 2 * nmax;
+}
+
+/**
+ * @brief True when every `termarr` entry is the sentinel or a valid index (VSH term, Kp spline slot).
+ *
+ * `ParseDwmData` rejects files failing this, so evaluators can gather without bounds checks.
+ */
+[[nodiscard]] bool DwmTermIndicesValid(const DwmData& dwm);
+
 /** @brief Load and parse `dwm07b104i.dat` Fortran-unformatted records. */
 [[nodiscard]] Result<DwmData, Error> LoadDwmData(const std::filesystem::path& path);
+/** @brief Parse in-memory `dwm07b104i.dat` bytes; `source` labels errors (path or buffer name). */
+[[nodiscard]] Result<DwmData, Error> ParseDwmData(std::span<const std::byte> bytes, std::string_view source);
 
 }  // namespace hwm14::detail
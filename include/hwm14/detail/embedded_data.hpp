@@ -0,0 +1,22 @@
+/**
+ * @file embedded_data.hpp
+ * @brief Internal accessors for data files compiled into the library (`HWM14_EMBED_DATA=ON`).
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Build-time embedded copies of the HWM14 data files.
+
+#include <cstddef>
+#include <span>
+
+namespace hwm14::detail {
+
+/** @brief Embedded `hwm123114.bin` bytes. */
+[[nodiscard]] std::span<const std::byte> EmbeddedHwmBin();
+/** @brief Embedded `dwm07b104i.dat` bytes. */
+[[nodiscard]] std::span<const std::byte> EmbeddedDwmDat();
+/** @brief Embedded `gd2qd.dat` bytes. */
+[[nodiscard]] std::span<const std::byte> EmbeddedGd2qdDat();
+
+}  // namespace hwm14::detail
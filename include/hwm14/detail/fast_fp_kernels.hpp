@@ -0,0 +1,23 @@
+/**
+ * @file fast_fp_kernels.hpp
+ * @brief Evaluator kernels compiled with reassociation and FMA contraction for `strict_fp = false`.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Relaxed floating-point copies of the hot quiet-wind synthesis kernels.
+
+namespace hwm14::detail::fast_fp {
+
+/** @brief Whether this CPU can run the kernels below; on x86 they are compiled for FMA and need it. */
+bool Available();
+
+/**
+ * @brief Zonal and meridional dot products of one level's basis row with its coefficient columns.
+ *
+ * Same math as the strict `DotN` pair, but the sums may be reordered into vector lanes and fused
+ * into FMA, so results differ from the strict path in the last bits. Call only when `Available()`.
+ */
+void QuietLevelSynth(const double* bz, const double* mcol, const double* tcol, int n, double& su, double& sv);
+
+}  // namespace hwm14::detail::fast_fp
@@ -0,0 +1,104 @@
+/**
+ * @file fixed_alf.hpp
+ * @brief Compile-time sized associated Legendre basis kernels for the shipped model dimensions.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Fixed-size ALF recurrence whose loops the compiler fully unrolls.
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace hwm14::detail {
+
+/**
+ * @brief Normalized ALF basis with `(nmax, mmax)` fixed at compile time.
+ *
+ * Performs exactly the same floating-point operations, in the same order, as `AlfState::Basis`, so the
+ * outputs are bit-identical. The recurrence tables are copied from a runtime `AlfState` rather than
+ * recomputed in `constexpr` context because `std::sqrt` is not `constexpr` and a hand-rolled square
+ * root would not be guaranteed to round identically.
+ */
+template <int N, int M>
+struct FixedAlf {
+  static_assert(N >= 1 && M >= 1 && M <= N, "FixedAlf requires 1 <= mmax <= nmax");
+
+  static constexpr int kNmax = N;
+  static constexpr int kMmax = M;
+  /** @brief Number of entries in each `(N + 1) x (M + 1)` output table. */
+  static constexpr std::size_t kSize = static_cast<std::size_t>(N + 1) * static_cast<std::size_t>(M + 1);
+
+  std::array<double, kSize> anm{};
+  std::array<double, kSize> bnm{};
+  std::array<double, kSize> dnm{};
+  std::array<double, M + 1> cm{};
+  std::array<double, N + 1> en{};
+
+  /** @brief Row-major index of `(n, m)`; matches `Idx2(n, m, M)`. */
+  static constexpr std::size_t I(int n, int m) {
+    return static_cast<std::size_t>(n) * static_cast<std::size_t>(M + 1) + static_cast<std::size_t>(m);
+  }
+
+  /** @brief Copy the recurrence coefficients out of an `AlfState` covering at least `(N, M)`. */
+  template <typename State>
+  [[nodiscard]] static FixedAlf FromState(const State& state) {
+    FixedAlf out{};
+    for (int n = 0; n <= N; ++n) {
+      out.en[static_cast<std::size_t>(n)] = state.en[static_cast<std::size_t>(n)];
+      for (int m = 0; m <= M; ++m) {
+        out.anm[I(n, m)] = state.Anm(n, m);
+        out.bnm[I(n, m)] = state.Bnm(n, m);
+        out.dnm[I(n, m)] = state.Dnm(n, m);
+      }
+    }
+    for (int m = 0; m <= M; ++m) {
+      out.cm[static_cast<std::size_t>(m)] = state.cm[static_cast<std::size_t>(m)];
+    }
+    return out;
+  }
+
+  /** @brief Evaluate P, V, W into caller buffers of `kSize` entries each (row stride `M + 1`). */
+  void Basis(double theta, double* P, double* V, double* W) const {
+    for (std::size_t k = 0; k < kSize; ++k) {
+      P[k] = 0.0;
+      V[k] = 0.0;
+      W[k] = 0.0;
+    }
+
+    constexpr double p00 = 0.70710678118654746;
+    P[I(0, 0)] = p00;
+    const double x = std::cos(theta);
+    const double y = std::sin(theta);
+
+    for (int m = 1; m <= M; ++m) {
+      const double mm = static_cast<double>(m);
+      W[I(m, m)] = cm[static_cast<std::size_t>(m)] * P[I(m - 1, m - 1)];
+      P[I(m, m)] = y * en[static_cast<std::size_t>(m)] * W[I(m, m)];
+      for (int n = m + 1; n <= N; ++n) {
+        W[I(n, m)] = anm[I(n, m)] * x * W[I(n - 1, m)] - bnm[I(n, m)] * W[I(n - 2, m)];
+        P[I(n, m)] = y * en[static_cast<std::size_t>(n)] * W[I(n, m)];
+        V[I(n, m)] = static_cast<double>(n) * x * W[I(n, m)] - dnm[I(n, m)] * W[I(n - 1, m)];
+        W[I(n - 2, m)] = mm * W[I(n - 2, m)];
+      }
+      W[I(N - 1, m)] = mm * W[I(N - 1, m)];
+      W[I(N, m)] = mm * W[I(N, m)];
+      V[I(m, m)] = x * W[I(m, m)];
+    }
+
+    P[I(1, 0)] = anm[I(1, 0)] * x * P[I(0, 0)];
+    V[I(1, 0)] = -P[I(1, 1)];
+    for (int n = 2; n <= N; ++n) {
+      P[I(n, 0)] = anm[I(n, 0)] * x * P[I(n - 1, 0)] - bnm[I(n, 0)] * P[I(n - 2, 0)];
+      V[I(n, 0)] = -P[I(n, 1)];
+    }
+  }
+};
+
+/** @brief Fixed kernel for the quiet-wind model (`maxn = 8`, `maxo = 4`) and the QD transform. */
+using FixedAlf84 = FixedAlf<8, 4>;
+/** @brief Fixed kernel for the DWM07 disturbance model (`nmax = 10`, `mmax = 3`). */
+using FixedAlf103 = FixedAlf<10, 3>;
+
+}  // namespace hwm14::detail
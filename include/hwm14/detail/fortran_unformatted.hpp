@@ -1,50 +1,127 @@
 /**
  * @file fortran_unformatted.hpp
- * @brief Internal helpers for Fortran sequential-unformatted record I/O.
+ * @brief Internal helpers for Fortran sequential-unformatted and stream-access reads over byte buffers.
  */
 #pragma once
 
 // Author: watsonryan
-// Purpose: Helpers for reading Fortran sequential-unformatted records.
+// Purpose: Zero-copy cursors for reading Fortran record and stream layouts from in-memory bytes.
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
-#include <fstream>
+#include <span>
 #include <type_traits>
 #include <vector>
 
 namespace hwm14::detail {
 
-/** @brief Read a single Fortran unformatted record payload (strip length sentinels). */
-inline bool ReadFortranRecordRaw(std::ifstream& in, std::vector<char>& payload) {
-  std::int32_t n1 = 0;
-  in.read(reinterpret_cast<char*>(&n1), static_cast<std::streamsize>(sizeof(n1)));
-  if (!in) {
-    return false;
+/**
+ * @brief Read-only typed view over an unaligned record payload.
+ *
+ * Elements are loaded with `memcpy`, so the view is valid for any payload alignment and never
+ * copies the record as a whole.
+ */
+template <typename T>
+class RecordView {
+ public:
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  RecordView() = default;
+  explicit RecordView(std::span<const std::byte> bytes) : bytes_(bytes) {}
+
+  /** @brief Number of whole elements in the payload. */
+  [[nodiscard]] std::size_t size() const { return bytes_.size() / sizeof(T); }
+  /** @brief True when the payload is an exact multiple of `sizeof(T)`. */
+  [[nodiscard]] bool exact() const { return bytes_.size() % sizeof(T) == 0; }
+  /** @brief Load element `i`. */
+  [[nodiscard]] T operator[](std::size_t i) const {
+    T out{};
+    std::memcpy(&out, bytes_.data() + i * sizeof(T), sizeof(T));
+    return out;
   }
-  if (n1 < 0) {
-    return false;
+  /** @brief Copy all elements into `out` (sized by caller) in one pass. */
+  void CopyTo(std::span<T> out) const {
+    if (!out.empty()) {
+      std::memcpy(out.data(), bytes_.data(), out.size() * sizeof(T));
+    }
   }
 
-  payload.resize(static_cast<std::size_t>(n1));
-  if (n1 > 0) {
-    in.read(payload.data(), static_cast<std::streamsize>(payload.size()));
-    if (!in) {
+ private:
+  std::span<const std::byte> bytes_{};
+};
+
+/** @brief Forward cursor over Fortran sequential-unformatted records (length-prefixed and -suffixed). */
+class FortranRecordCursor {
+ public:
+  explicit FortranRecordCursor(std::span<const std::byte> bytes) : bytes_(bytes) {}
+
+  /** @brief Advance to the next record and expose its payload (strip length sentinels). */
+  bool Next(std::span<const std::byte>& payload) {
+    std::int32_t n1 = 0;
+    if (!Load(pos_, n1) || n1 < 0) {
+      return false;
+    }
+    const auto n = static_cast<std::size_t>(n1);
+    const std::size_t begin = pos_ + sizeof(n1);
+    if (n > bytes_.size() - begin) {
+      return false;
+    }
+    std::int32_t n2 = 0;
+    if (!Load(begin + n, n2) || n2 != n1) {
       return false;
     }
+    payload = bytes_.subspan(begin, n);
+    pos_ = begin + n + sizeof(n2);
+    return true;
   }
 
-  std::int32_t n2 = 0;
-  in.read(reinterpret_cast<char*>(&n2), static_cast<std::streamsize>(sizeof(n2)));
-  if (!in || n2 != n1) {
-    return false;
+ private:
+  bool Load(std::size_t at, std::int32_t& out) const {
+    if (at > bytes_.size() || bytes_.size() - at < sizeof(out)) {
+      return false;
+    }
+    std::memcpy(&out, bytes_.data() + at, sizeof(out));
+    return true;
+  }
+
+  std::span<const std::byte> bytes_;
+  std::size_t pos_{0};
+};
+
+/** @brief Forward cursor over Fortran stream-access (unframed) binary data. */
+class StreamCursor {
+ public:
+  explicit StreamCursor(std::span<const std::byte> bytes) : bytes_(bytes) {}
+
+  template <typename T>
+  /** @brief Read one trivially-copyable value. */
+  bool Read(T& out) {
+    return ReadArray(&out, 1);
   }
-  return true;
-}
+
+  template <typename T>
+  /** @brief Read `n` contiguous trivially-copyable values into `out`. */
+  bool ReadArray(T* out, std::size_t n) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    if (n > (bytes_.size() - pos_) / sizeof(T)) {
+      return false;
+    }
+    if (n > 0) {
+      std::memcpy(out, bytes_.data() + pos_, n * sizeof(T));
+    }
+    pos_ += n * sizeof(T);
+    return true;
+  }
+
+ private:
+  std::span<const std::byte> bytes_;
+  std::size_t pos_{0};
+};
 
 template <typename T>
 /** @brief Unpack payload as one trivially-copyable scalar object. */
-inline bool UnpackRecordScalar(const std::vector<char>& payload, T& out) {
+inline bool UnpackRecordScalar(std::span<const std::byte> payload, T& out) {
   static_assert(std::is_trivially_copyable_v<T>);
   if (payload.size() != sizeof(T)) {
     return false;
@@ -54,17 +131,14 @@ inline bool UnpackRecordScalar(const std::vector<char>& payload, T& out) {
 }
 
 template <typename T>
-/** @brief Unpack payload as contiguous array of trivially-copyable objects. */
-inline bool UnpackRecordArray(const std::vector<char>& payload, std::vector<T>& out) {
-  static_assert(std::is_trivially_copyable_v<T>);
-  if (payload.size() % sizeof(T) != 0) {
+/** @brief Unpack payload as contiguous array of trivially-copyable objects, copying once into `out`. */
+inline bool UnpackRecordArray(std::span<const std::byte> payload, std::vector<T>& out) {
+  const RecordView<T> view(payload);
+  if (!view.exact()) {
     return false;
   }
-  const auto n = payload.size() / sizeof(T);
-  out.resize(n);
-  if (n > 0) {
-    std::memcpy(out.data(), payload.data(), payload.size());
-  }
+  out.resize(view.size());
+  view.CopyTo(out);
   return true;
 }
 
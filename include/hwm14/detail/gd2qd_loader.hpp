@@ -7,8 +7,11 @@
 // Author: watsonryan
 // Purpose: Loader for gd2qd.dat spherical harmonic coefficients.
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <span>
+#include <string_view>
 #include <vector>
 
 #include "hwm14/error.hpp"
@@ -28,5 +31,7 @@ struct Gd2qdData {
 
 /** @brief Load and parse `gd2qd.dat` Fortran-unformatted records. */
 [[nodiscard]] Result<Gd2qdData, Error> LoadGd2qdData(const std::filesystem::path& path);
+/** @brief Parse in-memory `gd2qd.dat` bytes; `source` labels errors (path or buffer name). */
+[[nodiscard]] Result<Gd2qdData, Error> ParseGd2qdData(std::span<const std::byte> bytes, std::string_view source);
 
 }  // namespace hwm14::detail
@@ -7,8 +7,11 @@
 // Author: watsonryan
 // Purpose: Stream-binary loader for HWM14 quiet-time coefficient metadata.
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <span>
+#include <string_view>
 #include <array>
 #include <vector>
 
@@ -38,5 +41,7 @@ struct HwmBinHeader {
 
 /** @brief Load and parse the HWM14 binary header and associated arrays. */
 [[nodiscard]] Result<HwmBinHeader, Error> LoadHwmBinHeader(const std::filesystem::path& path);
+/** @brief Parse in-memory `hwm123114.bin` bytes; `source` labels errors (path or buffer name). */
+[[nodiscard]] Result<HwmBinHeader, Error> ParseHwmBinHeader(std::span<const std::byte> bytes, std::string_view source);
 
 }  // namespace hwm14::detail
@@ -0,0 +1,45 @@
+/**
+ * @file mapped_file.hpp
+ * @brief Internal read-only memory mapping of whole files and shared-memory segments.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Read-only file mapping with a heap-copy fallback on platforms without mmap.
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "hwm14/error.hpp"
+#include "hwm14/result.hpp"
+
+namespace hwm14::detail {
+
+/** @brief Immutable byte range backed by a mapping that is released on destruction. */
+class MappedFile {
+ public:
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  ~MappedFile();
+
+  /** @brief Map `path` read-only (or read it into memory where mapping is unavailable). */
+  [[nodiscard]] static Result<std::shared_ptr<const MappedFile>, Error> Open(const std::filesystem::path& path);
+  /** @brief Take ownership of an existing read-only mapping created with `mmap`. */
+  [[nodiscard]] static std::shared_ptr<const MappedFile> AdoptMapping(const void* addr, std::size_t size);
+
+  /** @brief Mapped bytes. */
+  [[nodiscard]] std::span<const std::byte> bytes() const { return {data_, size_}; }
+
+ private:
+  MappedFile() = default;
+
+  const std::byte* data_{nullptr};
+  std::size_t size_{0};
+  bool mapped_{false};
+  std::vector<std::byte> fallback_{};
+};
+
+}  // namespace hwm14::detail
@@ -0,0 +1,45 @@
+/**
+ * @file model_blob.hpp
+ * @brief Internal serialization of fully derived model state into a mappable binary blob.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Versioned, aligned, checksummed blob format for near-instant model startup.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "hwm14/detail/model_impl.hpp"
+#include "hwm14/error.hpp"
+#include "hwm14/result.hpp"
+
+namespace hwm14::detail {
+
+/** @brief Current blob layout version; bumped on any incompatible layout change. */
+inline constexpr std::uint32_t kModelBlobVersion = 1;
+/** @brief Alignment of every blob section (bytes). */
+inline constexpr std::size_t kModelBlobAlignment = 64;
+
+/** @brief 64-bit checksum used by the blob header (multiply-xor over 8-byte words). */
+[[nodiscard]] std::uint64_t BlobChecksum(std::span<const std::byte> bytes);
+
+/** @brief Serialize derived model state; fails for models carrying ensemble members. */
+[[nodiscard]] Result<std::vector<std::byte>, Error> SerializeModelBlob(const Model::Impl& impl);
+
+/**
+ * @brief Rebuild model state from blob bytes.
+ *
+ * `mparm`/`tparm` become views into `bytes`, which must stay valid as long as `owner` is alive; small
+ * tables are copied. `bytes` must be aligned to at least `alignof(double)`.
+ */
+[[nodiscard]] Result<std::shared_ptr<Model::Impl>, Error> ModelImplFromBlob(std::span<const std::byte> bytes,
+                                                                           std::shared_ptr<const void> owner,
+                                                                           bool verify_checksum,
+                                                                           std::string_view where);
+
+}  // namespace hwm14::detail
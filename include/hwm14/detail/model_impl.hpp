@@ -0,0 +1,355 @@
+/**
+ * @file model_impl.hpp
+ * @brief Internal definition of `Model::Impl` and the associated Legendre basis state.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Shared internal model state used by the evaluator, blob, and loader translation units.
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "hwm14/detail/dwm_loader.hpp"
+#include "hwm14/detail/fixed_alf.hpp"
+#include "hwm14/detail/gd2qd_loader.hpp"
+#include "hwm14/detail/hwm_bin_loader.hpp"
+#include "hwm14/detail/quiet_level_kernels.hpp"
+#include "hwm14/hwm14.hpp"
+
+namespace hwm14::detail {
+
+/** @brief Flat index of `(n, m)` in a row-major `(nmax + 1) x (mmax + 1)` table. */
+inline std::size_t Idx2(int n, int m, int mmax) {
+  return static_cast<std::size_t>(n) * static_cast<std::size_t>(mmax + 1) + static_cast<std::size_t>(m);
+}
+
+/** @brief Flat index of order component `c0` for B-spline `level` in `HwmBinHeader::order`. */
+inline std::size_t HwmOrderIdx(int c0, int level, int ncomp) {
+  return static_cast<std::size_t>(c0) + static_cast<std::size_t>(ncomp) * static_cast<std::size_t>(level);
+}
+
+/** @brief Normalized associated Legendre recurrence coefficients and basis evaluator. */
+struct AlfState {
+  int nmax0{0};
+  int mmax0{0};
+  std::vector<double> anm;
+  std::vector<double> bnm;
+  std::vector<double> dnm;
+  std::vector<double> cm;
+  std::vector<double> en;
+  std::vector<double> marr;
+  std::vector<double> narr;
+
+  [[nodiscard]] double Anm(int n, int m) const { return anm[Idx2(n, m, mmax0)]; }
+  [[nodiscard]] double Bnm(int n, int m) const { return bnm[Idx2(n, m, mmax0)]; }
+  [[nodiscard]] double Dnm(int n, int m) const { return dnm[Idx2(n, m, mmax0)]; }
+
+  void Init(int nmax, int mmax) {
+    nmax0 = nmax;
+    mmax0 = mmax;
+    anm.assign(static_cast<std::size_t>(nmax0 + 1) * static_cast<std::size_t>(mmax0 + 1), 0.0);
+    bnm.assign(static_cast<std::size_t>(nmax0 + 1) * static_cast<std::size_t>(mmax0 + 1), 0.0);
+    dnm.assign(static_cast<std::size_t>(nmax0 + 1) * static_cast<std::size_t>(mmax0 + 1), 0.0);
+    cm.assign(static_cast<std::size_t>(mmax0 + 1), 0.0);
+    en.assign(static_cast<std::size_t>(nmax0 + 1), 0.0);
+    marr.assign(static_cast<std::size_t>(mmax0 + 1), 0.0);
+    narr.assign(static_cast<std::size_t>(nmax0 + 1), 0.0);
+
+    for (int n = 1; n <= nmax0; ++n) {
+      narr[static_cast<std::size_t>(n)] = static_cast<double>(n);
+      en[static_cast<std::size_t>(n)] = std::sqrt(static_cast<double>(n * (n + 1)));
+      anm[Idx2(n, 0, mmax0)] =
+          std::sqrt(static_cast<double>((2 * n - 1) * (2 * n + 1))) / narr[static_cast<std::size_t>(n)];
+      bnm[Idx2(n, 0, mmax0)] =
+          std::sqrt(static_cast<double>((2 * n + 1) * (n - 1) * (n - 1)) / static_cast<double>(2 * n - 3)) /
+          narr[static_cast<std::size_t>(n)];
+    }
+
+    for (int m = 1; m <= mmax0; ++m) {
+      marr[static_cast<std::size_t>(m)] = static_cast<double>(m);
+      cm[static_cast<std::size_t>(m)] = std::sqrt(static_cast<double>(2 * m + 1) / static_cast<double>(2 * m * m * (m + 1)));
+      for (int n = m + 1; n <= nmax0; ++n) {
+        anm[Idx2(n, m, mmax0)] = std::sqrt(static_cast<double>((2 * n - 1) * (2 * n + 1) * (n - 1)) /
+                                           static_cast<double>((n - m) * (n + m) * (n + 1)));
+        bnm[Idx2(n, m, mmax0)] =
+            std::sqrt(static_cast<double>((2 * n + 1) * (n + m - 1) * (n - m - 1) * (n - 2) * (n - 1)) /
+                      static_cast<double>((n - m) * (n + m) * (2 * n - 3) * n * (n + 1)));
+        dnm[Idx2(n, m, mmax0)] = std::sqrt(static_cast<double>((n - m) * (n + m) * (2 * n + 1) * (n - 1)) /
+                                           static_cast<double>((2 * n - 1) * (n + 1)));
+      }
+    }
+  }
+
+  void Basis(int nmax, int mmax, double theta, std::vector<double>& P, std::vector<double>& V, std::vector<double>& W) const {
+    P.assign(static_cast<std::size_t>(nmax + 1) * static_cast<std::size_t>(mmax + 1), 0.0);
+    V.assign(static_cast<std::size_t>(nmax + 1) * static_cast<std::size_t>(mmax + 1), 0.0);
+    W.assign(static_cast<std::size_t>(nmax + 1) * static_cast<std::size_t>(mmax + 1), 0.0);
+
+    constexpr double p00 = 0.70710678118654746;
+    P[Idx2(0, 0, mmax)] = p00;
+    const double x = std::cos(theta);
+    const double y = std::sin(theta);
+
+    for (int m = 1; m <= mmax; ++m) {
+      W[Idx2(m, m, mmax)] = cm[static_cast<std::size_t>(m)] * P[Idx2(m - 1, m - 1, mmax)];
+      P[Idx2(m, m, mmax)] = y * en[static_cast<std::size_t>(m)] * W[Idx2(m, m, mmax)];
+      for (int n = m + 1; n <= nmax; ++n) {
+        W[Idx2(n, m, mmax)] = Anm(n, m) * x * W[Idx2(n - 1, m, mmax)] - Bnm(n, m) * W[Idx2(n - 2, m, mmax)];
+        P[Idx2(n, m, mmax)] = y * en[static_cast<std::size_t>(n)] * W[Idx2(n, m, mmax)];
+        V[Idx2(n, m, mmax)] = narr[static_cast<std::size_t>(n)] * x * W[Idx2(n, m, mmax)] - Dnm(n, m) * W[Idx2(n - 1, m, mmax)];
+        W[Idx2(n - 2, m, mmax)] = marr[static_cast<std::size_t>(m)] * W[Idx2(n - 2, m, mmax)];
+      }
+      W[Idx2(nmax - 1, m, mmax)] = marr[static_cast<std::size_t>(m)] * W[Idx2(nmax - 1, m, mmax)];
+      W[Idx2(nmax, m, mmax)] = marr[static_cast<std::size_t>(m)] * W[Idx2(nmax, m, mmax)];
+      V[Idx2(m, m, mmax)] = x * W[Idx2(m, m, mmax)];
+    }
+
+    if (nmax >= 1) {
+      P[Idx2(1, 0, mmax)] = Anm(1, 0) * x * P[Idx2(0, 0, mmax)];
+      if (mmax >= 1) {
+        V[Idx2(1, 0, mmax)] = -P[Idx2(1, 1, mmax)];
+      }
+    }
+    for (int n = 2; n <= nmax; ++n) {
+      P[Idx2(n, 0, mmax)] = Anm(n, 0) * x * P[Idx2(n - 1, 0, mmax)] - Bnm(n, 0) * P[Idx2(n - 2, 0, mmax)];
+      if (mmax >= 1) {
+        V[Idx2(n, 0, mmax)] = -P[Idx2(n, 1, mmax)];
+      }
+    }
+  }
+};
+
+/** @brief Owning storage for derived quiet-wind coefficient columns built at load time. */
+struct QuietCoefficientStorage {
+  std::vector<double> mparm{};
+  std::vector<double> tparm{};
+};
+
+/**
+ * @brief `DwmData::termarr_flat` compiled into branch-free gather indices, in the original term order.
+ *
+ * Absent factors point at pad slots holding 1.0 (an extra `{1, 1}` VSH row, a fourth Kp slot, a 1.0
+ * latitude factor); multiplying by 1.0 is exact, so results match the sentinel-testing loop bit for
+ * bit. Terms are not regrouped because reordering the accumulation would change the rounding.
+ */
+struct DwmTermProgram {
+  std::vector<std::int32_t> vsh{};  // VSH row per term; `nvshterm` selects the pad row
+  std::vector<std::uint8_t> kp{};   // Kp spline slot per term; 3 selects the pad slot
+  std::vector<std::uint8_t> lat{};  // 1 applies the latitude weight, 0 the pad factor
+  std::vector<double> coeff{};
+};
+
+/** @brief Process-unique identifier for a `DisturbanceTables` instance (keys per-thread caches). */
+inline std::uint64_t NewDisturbanceTablesId() {
+  static std::atomic<std::uint64_t> next{1};
+  return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+/** @brief Parsed QD/DWM data and the tables derived from them; only needed when `ap3 >= 0`. */
+struct DisturbanceTables {
+  std::uint64_t id{NewDisturbanceTablesId()};
+
+  Gd2qdData gd2qd{};
+  DwmData dwm{};
+
+  int nmaxgeo{};
+  int mmaxgeo{};
+  int nvshterm{};
+
+  AlfState alf{};  // covers the quiet, QD, and DWM dimensions (the layout stored in blobs)
+  std::optional<FixedAlf84> alf84{};
+  std::optional<FixedAlf103> alf103{};
+
+  std::vector<double> xcoeff{};
+  std::vector<double> ycoeff{};
+  std::vector<double> zcoeff{};
+  std::vector<double> normadj{};
+
+  DwmTermProgram dwm_terms{};
+};
+
+/**
+ * @brief The nine sums of the QD expansion at one geodetic point: {x, y, z}, their theta gradients,
+ * and their phi gradients (the inputs to qlat, qlon, and the f1/f2 vectors).
+ */
+using QdSums = std::array<double, 9>;
+
+/**
+ * @brief `QdSums` tabulated on a regular geodetic grid for `Options::qd_grid_step_deg`.
+ *
+ * Rows run from -90 to 90 degrees latitude inclusive, columns from -180 degrees longitude with periodic
+ * wrap. Queries are served by bicubic (Catmull-Rom) interpolation; stencils crossing a pole continue
+ * on the opposite meridian with the gradient sums negated.
+ */
+struct QdLookupGrid {
+  double step_deg{};
+  int nlat{};
+  int nlon{};
+  std::vector<QdSums> nodes{};  // row-major [lat][lon]
+};
+
+/** @brief A model's `QdLookupGrid`, built once when its disturbance tables are first available. */
+struct LazyQdGrid {
+  double step_deg{};
+  std::once_flag once{};
+  std::shared_ptr<const QdLookupGrid> grid{};
+};
+
+/** @brief Deferred `DisturbanceTables` construction, run at most once across threads. */
+struct LazyDisturbance {
+  DataPaths paths{};
+  int quiet_maxn{};
+  int quiet_maxo{};
+  // Set by `Model::LoadInterned`: the state is keyed on these files, so they must be unchanged when read.
+  std::optional<DataPathsIdentity> interned_files{};
+
+  std::once_flag once{};
+  std::shared_ptr<const DisturbanceTables> tables{};
+  std::optional<Error> error{};
+};
+
+}  // namespace hwm14::detail
+
+namespace hwm14 {
+
+/**
+ * @brief Immutable parsed and derived model state shared by `Model` copies.
+ *
+ * The large quiet-wind coefficient arrays are views: `coeff_storage` keeps whatever owns them alive
+ * (a `detail::QuietCoefficientStorage` for file loads, a mapped blob for `LoadFromBlob`), so copies of
+ * an `Impl` share the same coefficients safely. `hwm.mparm` is left empty once the views are bound.
+ *
+ * The disturbance side lives in `disturbance` when loaded eagerly, behind `lazy_disturbance` when
+ * deferred to first use, and in neither for quiet-only models.
+ */
+struct Model::Impl {
+  DataPaths paths{};
+  detail::HwmBinHeader hwm{};
+  // Order table as loaded, kept once `WithTruncation` lowers `hwm.order`; empty while they are the same.
+  // Raw ensemble members arrive in this layout.
+  std::vector<std::int32_t> loaded_order{};
+
+  int maxo{};
+
+  detail::AlfState alf{};  // quiet-wind basis, covers (maxn, maxo)
+  std::optional<detail::FixedAlf84> alf84{};  // bound when `alf` covers (8, 4)
+  std::span<const detail::QuietLevelKernel> quiet_levels{};  // generated kernels, empty if unmatched
+
+  std::shared_ptr<const void> coeff_storage{};
+  std::span<const double> mparm{};  // [nbf x levels], level d at column d - level_first
+  std::span<const double> tparm{};  // [nbf x levels], level d at column d - level_first
+  int level_first{};  // first B-spline level held; non-zero only for altitude-banded loads
+  std::vector<float> mparm_f32{};  // float copies of mparm/tparm, filled for Options::single_precision
+  std::vector<float> tparm_f32{};
+  bool fast_fp{};  // Options::strict_fp == false on a CPU with detail::fast_fp::Available()
+  std::optional<AltitudeBand> altitude_band{};
+
+  int ensemble_members{};
+  std::vector<double> ens_mparm{};  // [nbf x ensemble_members x levels]
+  std::vector<double> ens_tparm{};  // [nbf x ensemble_members x levels]
+
+  std::shared_ptr<const detail::DisturbanceTables> disturbance{};
+  std::shared_ptr<detail::LazyDisturbance> lazy_disturbance{};
+  std::shared_ptr<detail::LazyQdGrid> qd_grid{};  // set for Options::qd_grid_step_deg > 0
+};
+
+}  // namespace hwm14
+
+namespace hwm14::detail {
+
+/** @brief Bind the fixed-dimension ALF kernels that `tables.alf` is large enough to feed. */
+template <typename Tables>
+void BindFixedAlfKernels(Tables& tables) {
+  tables.alf84.reset();
+  if (tables.alf.nmax0 >= FixedAlf84::kNmax && tables.alf.mmax0 >= FixedAlf84::kMmax) {
+    tables.alf84 = FixedAlf84::FromState(tables.alf);
+  }
+  if constexpr (requires { tables.alf103; }) {
+    tables.alf103.reset();
+    if (tables.alf.nmax0 >= FixedAlf103::kNmax && tables.alf.mmax0 >= FixedAlf103::kMmax) {
+      tables.alf103 = FixedAlf103::FromState(tables.alf);
+    }
+  }
+}
+
+/** @brief Fill `tables.dwm_terms` from `tables.dwm`; false if `termarr` holds out-of-range indices. */
+[[nodiscard]] bool CompileDwmTermProgram(DisturbanceTables& tables);
+
+/** @brief Bind generated quiet level kernels when built with them and `impl.hwm` matches their source. */
+void BindQuietLevelKernels(Model::Impl& impl);
+
+/**
+ * @brief Copy level `d`'s column laid out by `from.order` into the layout of `to.order`, whose orders
+ * are no higher; slots `to` drops are discarded and the rest of `dst` is zeroed.
+ */
+void RemapQuietLevelColumn(const HwmBinHeader& from,
+                           const HwmBinHeader& to,
+                           int d,
+                           std::span<const double> src,
+                           std::span<double> dst);
+
+/** @brief Reject malformed evaluation-policy options before any data is read. */
+[[nodiscard]] std::optional<Error> ValidateEvalOptions(const Options& options, std::string_view where);
+/** @brief `ValidateEvalOptions` for blob-backed loads, which also reject `Options::altitude_band`. */
+[[nodiscard]] std::optional<Error> ValidateBlobOptions(const Options& options, std::string_view where);
+
+/**
+ * @brief Apply the evaluation-policy options (`strict_fp`, `single_precision`, `qd_grid_step_deg`) to a
+ * freshly built `impl`; the QD grid is built here when the disturbance tables are already loaded.
+ */
+void BindEvalOptions(Model::Impl& impl, const Options& options);
+
+/** @brief The input checks of `Model::QuietWinds` and `TotalWinds` (finite, in range, inside the band). */
+[[nodiscard]] std::optional<Error> ValidateInputs(const Model::Impl& impl, const Inputs& in, std::string_view where);
+
+/** @brief Trigonometric tables of one quiet evaluation point, laid out as in `QuietLevelArgs`. */
+struct QuietHarmonics {
+  std::vector<double> fs;  // {cos, sin} of s * day angle, s = 0..maxs
+  std::vector<double> fm;  // {cos, sin} of m * longitude, m = 0..maxm
+  std::vector<double> fl;  // {cos, sin} of l * local-time angle, l = 0..maxl
+  std::vector<double> sn;  // sin(n * colatitude), n = 0..maxn
+};
+
+/** @brief The harmonics `Model::QuietWinds` computes for `in`. */
+void FillQuietHarmonics(const Model::Impl& impl, const Inputs& in, QuietHarmonics& out);
+
+/**
+ * @brief Quiet winds of a validated `in` from caller-supplied harmonics.
+ *
+ * Position-dependent pieces (ALF basis, vertical weights) are computed from `in`; with the harmonics of
+ * `FillQuietHarmonics` the result equals `Model::QuietWinds` bit for bit.
+ */
+[[nodiscard]] Winds QuietWindsWithHarmonics(const Model::Impl& impl, const Inputs& in, const QuietHarmonics& harmonics);
+
+/** @brief The MLT harmonics {cos(m phi), sin(m phi)}, m = 0..mmax, the disturbance evaluators compute. */
+void FillMltHarmonics(const DisturbanceTables& dist, double mlt_h, std::vector<std::array<double, 2>>& out);
+
+/**
+ * @brief Geographic disturbance winds of a validated `in` with `ap3 >= 0` from its QD coordinates and
+ * caller-supplied MLT harmonics (`mmax + 1` rows); exact harmonics reproduce `DisturbanceWindsGeo`.
+ */
+[[nodiscard]] Winds DisturbanceWindsWithMltHarmonics(const DisturbanceTables& dist,
+                                                     const Inputs& in,
+                                                     const QdCoordinates& qd,
+                                                     std::span<const std::array<double, 2>> mlt,
+                                                     bool fold_kp);
+
+/**
+ * @brief Disturbance tables of `impl`, loading them on first use for lazy models.
+ *
+ * Thread-safe. Fails with `kInvalidInput` for quiet-only models, or with the cached load error.
+ */
+[[nodiscard]] Result<std::shared_ptr<const DisturbanceTables>, Error> ResolveDisturbance(const Model::Impl& impl,
+                                                                                          std::string_view where);
+
+}  // namespace hwm14::detail
@@ -0,0 +1,43 @@
+/**
+ * @file quiet_level_kernels.hpp
+ * @brief Interface to build-time generated quiet-wind level kernels.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Per-level straight-line basis/synthesis kernels emitted by tools/hwm14_quiet_codegen.cpp.
+
+#include <span>
+
+#include "hwm14/detail/hwm_bin_loader.hpp"
+
+namespace hwm14::detail {
+
+/** @brief Point-dependent inputs shared by every level kernel (layouts as in `QuietScratch`). */
+struct QuietLevelArgs {
+  const double* fs{};  // [cos, sin] pairs of the seasonal harmonics
+  const double* fm{};  // [cos, sin] pairs of the longitude harmonics
+  const double* fl{};  // [cos, sin] pairs of the local-time harmonics
+  const double* gv{};  // V basis, row stride maxo + 1
+  const double* gw{};  // W basis, row stride maxo + 1
+  const double* sn{};  // sin(n * theta) for n = 0..maxn
+};
+
+/** @brief Generated kernels for one B-spline level with its order-table loops fully unrolled. */
+struct QuietLevelKernel {
+  /** @brief Fill `bz` with the level's basis row; returns the active term count. */
+  int (*fill)(const QuietLevelArgs& args, double* bz){};
+  /** @brief Sequential dot products of `bz` with the level's zonal and meridional columns. */
+  void (*synth)(const double* bz, const double* mcol, const double* tcol, double& su, double& sv){};
+  int terms{};
+};
+
+/**
+ * @brief Generated level kernels, or an empty span when `h` differs from the file they were built from.
+ *
+ * Defined in the generated translation unit; only linked when the library is configured with
+ * `HWM14_GENERATE_QUIET_KERNELS=ON`.
+ */
+[[nodiscard]] std::span<const QuietLevelKernel> GeneratedQuietLevelKernels(const HwmBinHeader& h);
+
+}  // namespace hwm14::detail
@@ -7,7 +7,11 @@
 // Author: watsonryan
 // Purpose: Public C++20 API for the HWM14 model.
 
+#include <cstddef>
 #include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
 
 #include "hwm14/data_paths.hpp"
 #include "hwm14/error.hpp"
@@ -39,6 +43,73 @@ class Model {
    * @return Loaded model or an error with code/message/detail.
    */
   [[nodiscard]] static Result<Model, Error> LoadWithSearchPaths(Options options = {});
+  /**
+   * @brief Load model data from caller-owned in-memory copies of the three data files.
+   *
+   * Buffers are parsed in place (no filesystem access, no temporary files) and need only outlive the
+   * call. Errors name the buffer (`<memory:...>`) in their detail.
+   */
+  [[nodiscard]] static Result<Model, Error> LoadFromMemory(std::span<const std::byte> hwm_bin,
+                                                           std::span<const std::byte> dwm_dat,
+                                                           std::span<const std::byte> gd2qd_dat,
+                                                           Options options = {});
+  /**
+   * @brief Load the data files compiled into the library (`HWM14_EMBED_DATA=ON`).
+   *
+   * Needs no filesystem access. Returns `kNotImplemented` when the library was built without embedded
+   * data. `LoadWithSearchPaths` also falls back to this when no data directory is found.
+   */
+  [[nodiscard]] static Result<Model, Error> LoadEmbedded(Options options = {});
+  /**
+   * @brief Load a precompiled model blob written by `SaveBlob` (see `hwm14_blob_cli`).
+   *
+   * The blob is memory-mapped; quiet-wind coefficient columns are used in place without copying and
+   * no derivation work is repeated. `options.verify_blob_checksum` controls checksum validation.
+   */
+  [[nodiscard]] static Result<Model, Error> LoadFromBlob(const std::filesystem::path& blob_path, Options options = {});
+
+  /**
+   * @brief Attach to a model published with `PublishShared` by another process.
+   *
+   * Maps the named POSIX shared-memory segment read-only and binds the coefficients in place, so all
+   * attached processes share one physical copy. Fails on missing or still-being-published segments, blob
+   * version mismatch, or a set `options.altitude_band` (as `LoadFromBlob` does).
+   */
+  [[nodiscard]] static Result<Model, Error> AttachShared(std::string_view name, Options options = {});
+  /** @brief `AttachShared`, falling back to a normal load through `ResolveDataPaths(options)` on failure. */
+  [[nodiscard]] static Result<Model, Error> AttachSharedOrLoad(std::string_view name, Options options = {});
+  /** @brief Remove a published segment name; existing attachments stay valid. Returns false if absent. */
+  static bool UnlinkShared(std::string_view name);
+
+  /**
+   * @brief `LoadFromDirectory` through a process-wide, thread-safe cache of derived model state.
+   *
+   * Entries are keyed on `IdentifyDataFiles` (canonical path, size, last write time) plus the options
+   * that shape the derived state (`quiet_only`, `lazy_disturbance`, `altitude_band`, `single_precision`,
+   * `strict_fp`, `qd_grid_step_deg`). A repeat load of unchanged files shares the cached state without parsing anything; a
+   * changed file replaces the stale entry. With `lazy_disturbance` the disturbance files are checked again
+   * when first read, and disturbance evaluation fails if they changed after interning.
+   */
+  [[nodiscard]] static Result<Model, Error> LoadInterned(std::filesystem::path data_dir, Options options = {});
+  /** @brief Drop interned entries loaded from `data_dir` (all when empty); returned models stay valid. */
+  static std::size_t EvictInterned(const std::filesystem::path& data_dir = {});
+  /** @brief Number of entries currently held by the interned cache. */
+  [[nodiscard]] static std::size_t InternedCount();
+
+  /**
+   * @brief Write this model's fully derived state as a versioned, aligned, checksummed blob.
+   * @return Number of bytes written or an error.
+   */
+  [[nodiscard]] Result<std::size_t, Error> SaveBlob(const std::filesystem::path& blob_path) const;
+  /**
+   * @brief Publish this model into a named POSIX shared-memory segment (blob layout).
+   *
+   * Any previous segment with the same name is replaced. The segment is created with mode 0600, so only
+   * processes of the publishing user can attach, and becomes attachable only once fully written. Not
+   * available on platforms without POSIX shm.
+   * @return Segment size in bytes or an error.
+   */
+  [[nodiscard]] Result<std::size_t, Error> PublishShared(std::string_view name) const;
 
   /** @brief Evaluate total (quiet + disturbance) winds in m/s. */
   [[nodiscard]] Result<Winds, Error> TotalWinds(const Inputs& in) const;
@@ -46,13 +117,157 @@ class Model {
   [[nodiscard]] Result<Winds, Error> QuietWinds(const Inputs& in) const;
   /** @brief Evaluate disturbance winds in geographic coordinates in m/s. */
   [[nodiscard]] Result<Winds, Error> DisturbanceWindsGeo(const Inputs& in) const;
+  /**
+   * @brief Evaluate geographic disturbance winds from a QD transform the caller already holds.
+   *
+   * `qd` must be `GeoToQd(in)` (or a batch row for `in`) for the result to match `DisturbanceWindsGeo(in)`.
+   */
+  [[nodiscard]] Result<Winds, Error> DisturbanceWindsGeo(const Inputs& in, const QdCoordinates& qd) const;
   /** @brief Evaluate disturbance winds in magnetic coordinates in m/s. */
   [[nodiscard]] Result<Winds, Error> DisturbanceWindsMag(double mlt_h, double mlat_deg, double kp) const;
+  /**
+   * @brief Evaluate magnetic-coordinate disturbance winds on an mlat x MLT grid for one or more Kp values.
+   *
+   * The ALF basis is built once per mlat row and the MLT harmonics once per column; each cell equals
+   * `DisturbanceWindsMag(mlt_h[j], mlat_deg[i], kp[k])` exactly.
+   * @param out Destination; cell `(k, i, j)` is written to `out[k * kp_stride + i * mlt_h.size() + j]`.
+   * @param kp_stride Distance between Kp slabs in `out`; zero means `mlat_deg.size() * mlt_h.size()`.
+   * @return Number of cells written or an error (in which case `out` is left unchanged).
+   */
+  [[nodiscard]] Result<std::size_t, Error> DisturbanceWindsMagGrid(std::span<const double> mlat_deg,
+                                                                  std::span<const double> mlt_h,
+                                                                  std::span<const double> kp,
+                                                                  std::span<Winds> out,
+                                                                  std::size_t kp_stride = 0) const;
+
+  /** @brief Geodetic-to-quasi-dipole transform of `in` (latitude, longitude, and epoch), with MLT and f1/f2. */
+  [[nodiscard]] Result<QdCoordinates, Error> GeoToQd(const Inputs& in) const;
+  /**
+   * @brief Batched `GeoToQd` writing structure-of-arrays columns.
+   *
+   * Rows sharing an epoch reuse the subsolar QD longitude; values equal `GeoToQd` exactly.
+   * @return Number of rows written or an error (rows are validated before any output is written).
+   */
+  [[nodiscard]] Result<std::size_t, Error> GeoToQdBatch(std::span<const Inputs> in,
+                                                       const QdCoordinateColumns& out) const;
+
+  /**
+   * @brief Compare the QD lookup grid (`Options::qd_grid_step_deg`) with the exact transform.
+   *
+   * Sweeps a 4 x 4 sub-grid of every cell (grid nodes excluded). Fails with `kInvalidInput` when the
+   * model uses the exact transform.
+   */
+  [[nodiscard]] Result<QdGridValidation, Error> ValidateQdGrid() const;
+
+  /** @brief Number of dense quiet-wind design-matrix columns (`nbf * (nlev + 1)` unless altitude-banded). */
+  [[nodiscard]] std::size_t QuietDesignColumns() const;
+  /** @brief B-spline level held in design column 0; non-zero only with `Options::altitude_band`. */
+  [[nodiscard]] std::size_t QuietFirstLevel() const;
+  /** @brief Coefficient slots per B-spline level (`nbf`); dense column = `level * nbf + offset`. */
+  [[nodiscard]] std::size_t QuietTermsPerLevel() const;
+  /** @brief Zonal quiet-wind coefficients (`mparm`) in design-matrix column order. */
+  [[nodiscard]] std::span<const double> QuietZonalCoefficients() const;
+  /** @brief Meridional quiet-wind coefficients (parity-derived `tparm`) in design-matrix column order. */
+  [[nodiscard]] std::span<const double> QuietMeridionalCoefficients() const;
+  /**
+   * @brief Write dense row-major quiet-wind design rows for a batch of inputs.
+   *
+   * Row `i` dotted with `QuietZonalCoefficients()` gives the zonal quiet wind of `in[i]`, and with
+   * `QuietMeridionalCoefficients()` the meridional one.
+   * @param in Input batch.
+   * @param out Destination of at least `in.size() * QuietDesignColumns()` values; fully overwritten.
+   * @return Number of rows written or an error.
+   */
+  [[nodiscard]] Result<std::size_t, Error> QuietDesignMatrixDense(std::span<const Inputs> in, std::span<double> out) const;
+  /**
+   * @brief Append sparse quiet-wind design rows for a batch of inputs.
+   *
+   * Rows are appended after any existing rows of `out`, so large matrices can be built chunk by chunk.
+   * @return Number of rows appended or an error (in which case `out` is left unchanged).
+   */
+  [[nodiscard]] Result<std::size_t, Error> AppendQuietDesignRows(std::span<const Inputs> in,
+                                                                SparseDesignMatrix& out) const;
+
+  /**
+   * @brief Derive a model carrying additional quiet-wind coefficient ensemble members.
+   *
+   * Each set is a raw `mparm` array in `hwm123114.bin` layout (`nbf * (nlev + 1)` values, before the
+   * parity split); the matching `tparm` is derived with the same rules used at load. On a model from
+   * `WithTruncation` the sets are still in the loaded layout and are truncated like the base columns.
+   * Members already present on this model are kept, new ones are appended after them.
+   */
+  [[nodiscard]] Result<Model, Error> WithEnsembleMembers(std::vector<std::vector<double>> raw_mparm_sets) const;
+  /** @brief Derive ensemble members from `hwm123114.bin`-format files sharing this model's loaded order table. */
+  [[nodiscard]] Result<Model, Error> WithEnsembleMembersFromFiles(std::span<const std::filesystem::path> hwm_bins) const;
+  /** @brief Number of quiet-wind ensemble members (zero for a plain model). */
+  [[nodiscard]] std::size_t EnsembleSize() const;
+  /**
+   * @brief Evaluate quiet winds of every ensemble member for a batch of inputs.
+   *
+   * The basis is built once per input and shared by all members.
+   * @param out Row-major `in.size() x EnsembleSize()` destination.
+   * @return Number of input rows evaluated or an error.
+   */
+  [[nodiscard]] Result<std::size_t, Error> QuietWindsEnsemble(std::span<const Inputs> in, std::span<Winds> out) const;
+
+  /**
+   * @brief Derive a model with a lower quiet-wind harmonic truncation.
+   *
+   * The order table is lowered as `truncation` describes and the coefficient columns are rebuilt
+   * compactly for it, so every held level synthesizes fewer terms; the ALF basis shrinks when the
+   * largest orders drop. Ensemble members are truncated alongside. Generated level kernels only match
+   * the loaded truncation and are not used by the derived model. Use `CompareQuietWinds` against this
+   * model to measure the accuracy given up.
+   */
+  [[nodiscard]] Result<Model, Error> WithTruncation(const QuietTruncation& truncation) const;
+  /** @brief Quiet basis terms summed over the held B-spline levels (smaller after `WithTruncation`). */
+  [[nodiscard]] std::size_t QuietActiveTerms() const;
+  /** @brief True when quiet synthesis runs the relaxed-FP kernels (`strict_fp = false` on a CPU that has FMA). */
+  [[nodiscard]] bool RelaxedFpKernels() const;
+  /**
+   * @brief Compare this model's quiet winds with `reference` on every input.
+   * @return Difference statistics, or the first row either model rejects.
+   */
+  [[nodiscard]] Result<WindsDifference, Error> CompareQuietWinds(const Model& reference,
+                                                                std::span<const Inputs> in) const;
+
+  /**
+   * @brief Evaluate total winds along a time-ordered trajectory, exactly only at adaptive knots.
+   *
+   * The trajectory is split into segments wherever `yyddd` or `ap3` changes (the winds may jump
+   * there). Each segment starts with knots every `options.initial_knot_stride` samples plus its ends;
+   * knots are evaluated with `TotalWinds` and joined by cubic Hermite interpolation in time, with
+   * derivatives from two-sided differences of neighbouring knots. Every interval is checked against
+   * the exact model at its middle sample and split there while the error exceeds
+   * `options.tolerance_mps`. Samples evaluated exactly (knots and check samples) keep their exact value.
+   * @param in Samples with strictly increasing time (`yyddd` day plus `ut_seconds`). Two-digit years wrap
+   *        at the century relative to the first sample, so 99365 may be followed by 00001.
+   * @param out Destination of at least `in.size()` values.
+   * @return Knot and evaluation counts, or the first row error (earlier segments are already written).
+   */
+  [[nodiscard]] Result<TrajectoryReport, Error> EvaluateTrajectory(std::span<const Inputs> in,
+                                                                  std::span<Winds> out,
+                                                                  const TrajectoryOptions& options = {}) const;
+
+  /**
+   * @brief `TotalWinds` over a batch in arbitrary order, evaluated in a locality-aware schedule.
+   *
+   * Rows are visited sorted by epoch (`yyddd`, `ut_seconds`), active vertical level band, latitude,
+   * longitude and altitude. Each row keeps the intermediates it shares with the row visited before it:
+   * harmonics, the quiet ALF basis, vertical weights, the QD transform and the subsolar QD longitude.
+   * Results go to the rows' original positions and equal `TotalWinds` bit for bit.
+   * @param out Destination of at least `in.size()` values.
+   * @return Reuse counts, or the first invalid row (nothing is written when validation fails).
+   */
+  [[nodiscard]] Result<BatchReuseReport, Error> TotalWindsScheduled(std::span<const Inputs> in,
+                                                                   std::span<Winds> out) const;
 
   /** @brief Alias of TotalWinds for API ergonomics. */
   [[nodiscard]] Result<Winds, Error> Evaluate(const Inputs& in) const;
 
  private:
+  friend class TrackEvaluator;
+
   [[nodiscard]] static Result<Model, Error> LoadFromResolvedPaths(DataPaths paths, Options options);
 
   explicit Model(std::shared_ptr<const Impl> impl, Options options) : impl_(std::move(impl)), options_(std::move(options)) {}
@@ -0,0 +1,69 @@
+/**
+ * @file model_handle.hpp
+ * @brief Hot-reloadable model reference with lock-free reads for long-running services.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Publish replacement models atomically while evaluators keep using their snapshot.
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include "hwm14/hwm14.hpp"
+
+namespace hwm14 {
+
+/**
+ * @brief Atomically swappable `Model` shared by evaluator threads.
+ *
+ * Readers call `Snapshot()` once per batch and evaluate on the returned model without locks; a
+ * reload builds the replacement off to the side and publishes it with one atomic store, so in-flight
+ * batches finish on the state they started with and the old state is freed when its last snapshot
+ * is dropped. Writers are serialized among themselves only.
+ */
+class ModelHandle {
+ public:
+  /**
+   * @param initial Model published as generation 0.
+   * @param reload_options Options used by `Reload` / `ReloadAsync` loads.
+   */
+  explicit ModelHandle(Model initial, Options reload_options = {});
+
+  ModelHandle(const ModelHandle&) = delete;
+  ModelHandle& operator=(const ModelHandle&) = delete;
+  ~ModelHandle();
+
+  /** @brief Current model; stays valid (and unchanged) for as long as the caller holds it. */
+  [[nodiscard]] std::shared_ptr<const Model> Snapshot() const;
+  /** @brief Number of models published after the initial one. */
+  [[nodiscard]] std::uint64_t Generation() const;
+
+  /** @brief Publish `model` as the new current snapshot; returns its generation. */
+  std::uint64_t Publish(Model model);
+  /**
+   * @brief Load `data_dir` with the handle's options and publish it.
+   *
+   * On failure the current snapshot is left in place and the load error is returned.
+   * @return Generation of the published model or an error.
+   */
+  [[nodiscard]] Result<std::uint64_t, Error> Reload(const std::filesystem::path& data_dir);
+  /** @brief `Reload` on a background thread. */
+  [[nodiscard]] std::future<Result<std::uint64_t, Error>> ReloadAsync(std::filesystem::path data_dir);
+
+ private:
+  // The current-snapshot slot. Its atomic representation depends on the sanitizer, so it is defined
+  // only in model_handle.cpp and the class layout is the same in every build.
+  struct Current;
+
+  std::unique_ptr<Current> current_;
+  std::atomic<std::uint64_t> generation_{0};
+  std::mutex publish_mutex_{};
+  Options reload_options_{};
+};
+
+}  // namespace hwm14
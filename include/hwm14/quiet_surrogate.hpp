@@ -0,0 +1,111 @@
+/**
+ * @file quiet_surrogate.hpp
+ * @brief Lattice-interpolated approximate quiet winds for high-volume sampling.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Tabulate quiet winds for one day on a (lat, lon or local time, altitude, UT) lattice.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace hwm14 {
+
+/** @brief Tensor-product interpolation order of a `QuietSurrogate`. */
+enum class SurrogateInterpolation {
+  kLinear,  // 16 lattice values per point
+  kCubic,   // Catmull-Rom, 256 lattice values per point
+};
+
+/** @brief Second lattice axis of a `QuietSurrogate`. */
+enum class SurrogateAxis {
+  kLongitude,  // degrees, periodic over 360
+  kLocalTime,  // solar local time in hours, periodic over 24; tides vary slowly in UT on this axis
+};
+
+/** @brief Lattice definition for `QuietSurrogate::Build`. */
+struct QuietSurrogateSpec {
+  /** @brief Day sampled (YYDDD; only the day of year matters). Other days fall back to the model. */
+  int yyddd{};
+  double lat_min_deg{-90.0};
+  double lat_max_deg{90.0};
+  double lat_step_deg{5.0};
+  SurrogateAxis axis{SurrogateAxis::kLocalTime};
+  /** @brief Step of the second axis: degrees for longitude, hours for local time; must divide the period. */
+  double axis_step{1.0};
+  double alt_min_km{100.0};
+  double alt_max_km{500.0};
+  double alt_step_km{10.0};
+  /** @brief UT step in hours; must divide 24. */
+  double ut_step_h{1.0};
+  SurrogateInterpolation interpolation{SurrogateInterpolation::kLinear};
+  /** @brief Random in-lattice points compared with the exact model at build time (0 skips the check). */
+  std::size_t validation_points{2000};
+  std::uint64_t validation_seed{1};
+};
+
+/**
+ * @brief Approximate quiet-wind evaluator interpolating a precomputed lattice.
+ *
+ * Points on the sampled day inside the latitude and altitude ranges are interpolated; every other
+ * input is answered by the wrapped model's exact `QuietWinds`, including its input validation.
+ * Copies share the lattice.
+ */
+class QuietSurrogate {
+ public:
+  /**
+   * @brief Sample `model.QuietWinds` on the lattice described by `spec`.
+   *
+   * Building costs one exact evaluation per lattice node plus `spec.validation_points`.
+   */
+  [[nodiscard]] static Result<QuietSurrogate, Error> Build(Model model, const QuietSurrogateSpec& spec);
+
+  /** @brief Lattice definition used at build time. */
+  [[nodiscard]] const QuietSurrogateSpec& Spec() const { return spec_; }
+  /** @brief Held-out error measured at build time (`samples == 0` when validation was skipped). */
+  [[nodiscard]] const WindsDifference& Report() const { return report_; }
+  /** @brief Compare against the exact model on `samples` random in-lattice points. */
+  [[nodiscard]] WindsDifference Validate(std::size_t samples, std::uint64_t seed) const;
+  /** @brief Lattice values held, in bytes. */
+  [[nodiscard]] std::size_t LatticeBytes() const;
+
+  /** @brief True when `in` is answered from the lattice rather than the exact model. */
+  [[nodiscard]] bool Covers(const Inputs& in) const;
+  /** @brief Interpolated quiet winds inside the lattice, exact `Model::QuietWinds` outside it. */
+  [[nodiscard]] Result<Winds, Error> QuietWinds(const Inputs& in) const;
+  /**
+   * @brief `QuietWinds` over a batch.
+   * @param out Destination of at least `in.size()` values.
+   * @return Number of rows written, or the first row error (earlier rows are already written).
+   */
+  [[nodiscard]] Result<std::size_t, Error> QuietWindsBatch(std::span<const Inputs> in, std::span<Winds> out) const;
+
+ private:
+  struct Axis {
+    double origin{};
+    double step{};
+    int count{};
+    bool periodic{};
+  };
+
+  QuietSurrogate(Model model, QuietSurrogateSpec spec, std::array<Axis, 4> axes);
+
+  [[nodiscard]] Winds Interpolate(const Inputs& in) const;
+  template <int K>
+  [[nodiscard]] Winds InterpolateTaps(const std::array<double, 4>& coords) const;
+
+  Model model_;
+  QuietSurrogateSpec spec_{};
+  std::array<Axis, 4> axes_{};  // ut, alt, lat, second axis (outermost to innermost in `lattice_`)
+  std::shared_ptr<const std::vector<Winds>> lattice_{};
+  WindsDifference report_{};
+};
+
+}  // namespace hwm14
@@ -7,7 +7,12 @@
 // Author: watsonryan
 // Purpose: Public types for HWM14 inputs, outputs, and options.
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
 
 namespace hwm14 {
 
@@ -35,16 +40,210 @@ struct Winds {
   double zonal_mps{};
 };
 
+/**
+ * @brief One nonzero entry of a quiet-wind design-matrix row.
+ *
+ * The entry multiplies coefficient `offset` of B-spline level `level`, i.e. dense column
+ * `level * nbf + offset` of `Model::QuietZonalCoefficients()` / `QuietMeridionalCoefficients()`.
+ * `value` already includes the vertical weight of the level.
+ */
+struct DesignEntry {
+  /** @brief B-spline level index `d`, relative to `Model::QuietFirstLevel()`. */
+  std::int32_t level{};
+  /** @brief Term offset within the level's coefficient column. */
+  std::int32_t offset{};
+  /** @brief Vertical weight times basis value. */
+  double value{};
+};
+
+/** @brief Compressed-row sparse quiet-wind design matrix. */
+struct SparseDesignMatrix {
+  /** @brief Row start offsets into `entries`; holds `rows + 1` values once populated. */
+  std::vector<std::size_t> row_ptr{};
+  /** @brief Row-ordered nonzero entries. */
+  std::vector<DesignEntry> entries{};
+};
+
+/** @brief Quasi-dipole coordinates, magnetic local time, and QD base vectors of one geodetic point. */
+struct QdCoordinates {
+  /** @brief Quasi-dipole latitude in degrees. */
+  double qlat_deg{};
+  /** @brief Quasi-dipole longitude in degrees, in [-180, 180]. */
+  double qlon_deg{};
+  /** @brief Magnetic local time in hours (not wrapped into [0, 24)). */
+  double mlt_h{};
+  /** @brief Eastward component of base vector f1. */
+  double f1_east{};
+  /** @brief Northward component of base vector f1. */
+  double f1_north{};
+  /** @brief Eastward component of base vector f2. */
+  double f2_east{};
+  /** @brief Northward component of base vector f2. */
+  double f2_north{};
+};
+
+/**
+ * @brief Structure-of-arrays destination for `Model::GeoToQdBatch`.
+ *
+ * Each non-empty column receives one value per input row; empty columns are skipped.
+ */
+struct QdCoordinateColumns {
+  /** @brief Quasi-dipole latitude in degrees. */
+  std::span<double> qlat_deg{};
+  /** @brief Quasi-dipole longitude in degrees, in [-180, 180]. */
+  std::span<double> qlon_deg{};
+  /** @brief Magnetic local time in hours (not wrapped into [0, 24)). */
+  std::span<double> mlt_h{};
+  /** @brief Eastward component of base vector f1. */
+  std::span<double> f1_east{};
+  /** @brief Northward component of base vector f1. */
+  std::span<double> f1_north{};
+  /** @brief Eastward component of base vector f2. */
+  std::span<double> f2_east{};
+  /** @brief Northward component of base vector f2. */
+  std::span<double> f2_north{};
+};
+
+/** @brief Largest differences between the QD lookup grid and the exact transform over a sweep. */
+struct QdGridValidation {
+  /** @brief Grid spacing in degrees. */
+  double step_deg{};
+  /** @brief Number of points compared (15 off-node points per grid cell). */
+  std::size_t samples{};
+  /** @brief Maximum QD latitude error in degrees. */
+  double max_qlat_err_deg{};
+  /** @brief Maximum QD longitude error in degrees, scaled by cos(qlat) (an east-west arc). */
+  double max_qlon_arc_err_deg{};
+  /** @brief Maximum error of any f1/f2 component. */
+  double max_f_err{};
+};
+
+/**
+ * @brief Lowered quiet-wind harmonic truncation for `Model::WithTruncation`.
+ *
+ * Each set cap lowers the matching entry of every level's order table; levels already at or below it
+ * keep their truncation, and unset caps keep the loaded one.
+ */
+struct QuietTruncation {
+  /** @brief Highest stationary planetary wave number (`pmaxm`). */
+  std::optional<int> max_planetary_wave{};
+  /** @brief Highest migrating tide (`tmaxl`). */
+  std::optional<int> max_tide{};
+  /** @brief Highest seasonal harmonic of the zonal-mean, wave, and tide terms (`amaxs`, `pmaxs`, `tmaxs`). */
+  std::optional<int> max_seasonal{};
+  /** @brief Highest latitudinal order of the zonal-mean terms (`amaxn`). */
+  std::optional<int> max_zonal_mean_degree{};
+  /** @brief Highest Legendre degree of the wave and tide terms (`pmaxn`, `tmaxn`). */
+  std::optional<int> max_wave_degree{};
+  /**
+   * @brief Zero coefficients whose magnitude is below this (m/s); order entries whose dropped terms
+   * would then all be zero are lowered too.
+   */
+  double coefficient_threshold{0.0};
+};
+
+/** @brief Horizontal wind difference between an approximate and a reference evaluator over a set of inputs. */
+struct WindsDifference {
+  /** @brief Number of inputs compared; `rms_mps` and `max_mps` are zero when it is zero. */
+  std::size_t samples{};
+  /** @brief Root mean square of the horizontal vector difference in m/s. */
+  double rms_mps{};
+  /** @brief Largest horizontal vector difference in m/s. */
+  double max_mps{};
+};
+
+/** @brief Knot placement and error control for `Model::EvaluateTrajectory`. */
+struct TrajectoryOptions {
+  /**
+   * @brief Largest accepted horizontal vector error (m/s) between the interpolant and the exact model at
+   * an interval's check sample; failing intervals are split there.
+   */
+  double tolerance_mps{0.5};
+  /** @brief Samples between the initial knots of each segment (at least 1). */
+  std::size_t initial_knot_stride{32};
+};
+
+/** @brief Work done by one `Model::EvaluateTrajectory` call. */
+struct TrajectoryReport {
+  std::size_t samples{};
+  /** @brief Runs of samples sharing `yyddd` and `ap3`; the winds may jump between them. */
+  std::size_t segments{};
+  /** @brief Samples used as Hermite knots. */
+  std::size_t knots{};
+  /** @brief Exact evaluations: knots plus interval check samples. */
+  std::size_t exact_evaluations{};
+  /** @brief Largest interpolation error seen at the check samples of the accepted intervals, in m/s. */
+  double max_check_error_mps{};
+};
+
+/** @brief Intermediate reuse achieved by one `Model::TotalWindsScheduled` call. */
+struct BatchReuseReport {
+  std::size_t samples{};
+  /** @brief Runs of scheduled rows sharing `yyddd` and `ut_seconds`. */
+  std::size_t epochs{};
+  /** @brief Rows that kept the previous row's quiet ALF basis and colatitude sines (same latitude). */
+  std::size_t alf_reuses{};
+  /** @brief Rows that kept the previous row's vertical weights (same altitude). */
+  std::size_t vertical_reuses{};
+  /** @brief Rows whose active levels matched the previous row's (coefficient columns already in cache). */
+  std::size_t level_reuses{};
+  /** @brief Disturbance rows that kept the previous disturbance row's QD transform (same latitude and longitude). */
+  std::size_t qd_reuses{};
+  /** @brief Disturbance rows that kept the previous disturbance row's subsolar QD longitude (same epoch). */
+  std::size_t subsolar_reuses{};
+};
+
+/** @brief Inclusive geodetic altitude range in km for `Options::altitude_band`. */
+struct AltitudeBand {
+  double min_km{};
+  double max_km{};
+};
+
 /** @brief Runtime options controlling model load and evaluation policy. */
 struct Options {
-  /** @brief Enforce strict floating-point behavior for parity-sensitive runs. */
+  /**
+   * @brief Evaluate with the strict, parity-reference kernels; `false` lets the per-level quiet dot products
+   * be reordered and, where the CPU supports it, fused into FMA (results differ from the strict path in
+   * the last bits). x86 CPUs without FMA keep the strict kernels; see `Model::RelaxedFpKernels`.
+   */
   bool strict_fp{true};
-  /** @brief Enable optional runtime caches for repeated evaluations. */
+  /**
+   * @brief Enable optional runtime caches for repeated evaluations.
+   *
+   * Disturbance winds then reuse per-thread DWM coefficients folded for the last few Kp values
+   * (results differ from the uncached path by reassociation only, ~1e-13 m/s).
+   */
   bool enable_cache{false};
   /** @brief Allow `HWMPATH` environment variable in path resolution. */
   bool allow_env_hwmpath{true};
   /** @brief Optional explicit data directory override. */
   std::filesystem::path data_dir{};
+  /** @brief Validate the blob checksum in `Model::LoadFromBlob` (skip only for trusted, hot-path startup). */
+  bool verify_blob_checksum{true};
+  /** @brief Read the data files concurrently and derive tables on worker threads (results are identical). */
+  bool parallel_load{false};
+  /** @brief Defer reading the QD/DWM files until the first disturbance evaluation (file-based loads only). */
+  bool lazy_disturbance{false};
+  /** @brief Load only the quiet-wind model; disturbance evaluations fail with `kInvalidInput`. */
+  bool quiet_only{false};
+  /**
+   * @brief Keep only the quiet-wind B-spline levels supporting this band (file and memory loads).
+   *
+   * Quiet evaluations outside the band fail with `kInvalidInput`; results inside it are identical to
+   * a full load.
+   */
+  std::optional<AltitudeBand> altitude_band{};
+  /**
+   * @brief Evaluate quiet winds from float32 coefficient copies (about 1e-4 m/s from the double path).
+   *
+   * Design-matrix, coefficient, and ensemble APIs keep using the double coefficients.
+   */
+  bool single_precision{false};
+  /**
+   * @brief Serve the geodetic-to-QD transform from a bicubic lookup grid with this spacing in degrees
+   * (must divide 180); 0 uses the exact expansion. See `Model::ValidateQdGrid` for the error.
+   */
+  double qd_grid_step_deg{0.0};
 };
 
 }  // namespace hwm14
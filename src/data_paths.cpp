@@ -6,6 +6,7 @@
 #include "hwm14/data_paths.hpp"
 
 #include <cstdlib>
+#include <system_error>
 #include <vector>
 
 namespace hwm14 {
@@ -24,6 +25,23 @@ Result<DataPaths, Error> BuildPathsFromBase(const std::filesystem::path& base) {
       MakeError(ErrorCode::kDataPathNotFound, "One or more required data files are missing", base.string(), "BuildPathsFromBase"));
 }
 
+Result<DataFileIdentity, Error> IdentifyFile(const std::filesystem::path& path) {
+  std::error_code ec;
+  DataFileIdentity id;
+  id.canonical = std::filesystem::canonical(path, ec);
+  if (!ec) {
+    id.size = std::filesystem::file_size(id.canonical, ec);
+  }
+  if (!ec) {
+    id.mtime = std::filesystem::last_write_time(id.canonical, ec);
+  }
+  if (ec) {
+    return Result<DataFileIdentity, Error>::Err(
+        MakeError(ErrorCode::kDataPathNotFound, "Cannot stat data file", path.string(), "IdentifyDataFiles"));
+  }
+  return Result<DataFileIdentity, Error>::Ok(std::move(id));
+}
+
 }  // namespace
 
 Result<DataPaths, Error> ResolveDataPathsFromDirectory(const std::filesystem::path& data_dir) {
@@ -70,4 +88,21 @@ Result<DataPaths, Error> ResolveDataPaths(const Options& options) {
   return ResolveDataPathsWithSearchPaths(options);
 }
 
+Result<DataPathsIdentity, Error> IdentifyDataFiles(const DataPaths& paths) {
+  auto hwm_bin = IdentifyFile(paths.hwm_bin);
+  if (!hwm_bin) {
+    return Result<DataPathsIdentity, Error>::Err(hwm_bin.error());
+  }
+  auto dwm_dat = IdentifyFile(paths.dwm_dat);
+  if (!dwm_dat) {
+    return Result<DataPathsIdentity, Error>::Err(dwm_dat.error());
+  }
+  auto gd2qd_dat = IdentifyFile(paths.gd2qd_dat);
+  if (!gd2qd_dat) {
+    return Result<DataPathsIdentity, Error>::Err(gd2qd_dat.error());
+  }
+  return Result<DataPathsIdentity, Error>::Ok(
+      DataPathsIdentity{std::move(hwm_bin.value()), std::move(dwm_dat.value()), std::move(gd2qd_dat.value())});
+}
+
 }  // namespace hwm14
@@ -5,90 +5,112 @@
 
 #include "hwm14/detail/dwm_loader.hpp"
 
-#include <cstring>
-#include <fstream>
+#include <string>
 #include <vector>
 
 #include "hwm14/detail/fortran_unformatted.hpp"
+#include "hwm14/detail/mapped_file.hpp"
 
 namespace hwm14::detail {
 
 Result<DwmData, Error> LoadDwmData(const std::filesystem::path& path) {
-  std::ifstream in(path, std::ios::binary);
-  if (!in.is_open()) {
-    return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileOpenFailed, "failed to open dwm07b104i.dat", path.string(), "LoadDwmData"));
+  const auto file = MappedFile::Open(path);
+  if (!file) {
+    const bool open_failed = file.error().code == ErrorCode::kDataFileOpenFailed;
+    return Result<DwmData, Error>::Err(MakeError(file.error().code,
+                                                 open_failed ? "failed to open dwm07b104i.dat" : file.error().message,
+                                                 path.string(),
+                                                 "LoadDwmData"));
   }
+  return ParseDwmData(file.value()->bytes(), path.string());
+}
 
-  std::vector<char> rec;
-  if (!ReadFortranRecordRaw(in, rec)) {
+Result<DwmData, Error> ParseDwmData(std::span<const std::byte> bytes, std::string_view source) {
+  const std::string path(source);
+  FortranRecordCursor in(bytes);
+  std::span<const std::byte> rec;
+  if (!in.Next(rec)) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "failed reading DWM header", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "failed reading DWM header", path, "ParseDwmData"));
   }
 
   if (rec.size() != 3 * sizeof(std::int32_t)) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "unexpected DWM header size", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "unexpected DWM header size", path, "ParseDwmData"));
   }
 
   DwmData out;
-  const auto* p = rec.data();
-  std::memcpy(&out.nterm, p, sizeof(out.nterm));
-  p += sizeof(out.nterm);
-  std::memcpy(&out.mmax, p, sizeof(out.mmax));
-  p += sizeof(out.mmax);
-  std::memcpy(&out.nmax, p, sizeof(out.nmax));
+  const RecordView<std::int32_t> header(rec);
+  out.nterm = header[0];
+  out.mmax = header[1];
+  out.nmax = header[2];
 
   if (out.nterm <= 0 || out.nterm > 500000 || out.mmax < 0 || out.nmax < 0) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "invalid DWM dimensions", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "invalid DWM dimensions", path, "ParseDwmData"));
   }
 
-  if (!ReadFortranRecordRaw(in, rec)) {
+  if (!in.Next(rec)) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "failed reading DWM termarr", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "failed reading DWM termarr", path, "ParseDwmData"));
   }
 
   std::vector<std::int32_t> termarr;
   if (!UnpackRecordArray<std::int32_t>(rec, termarr)) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "invalid DWM termarr payload", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "invalid DWM termarr payload", path, "ParseDwmData"));
   }
 
   if (termarr.size() != static_cast<std::size_t>(out.nterm) * 3U) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "DWM termarr count mismatch", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "DWM termarr count mismatch", path, "ParseDwmData"));
   }
 
-  if (!ReadFortranRecordRaw(in, rec)) {
+  if (!in.Next(rec)) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "failed reading DWM coefficients", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "failed reading DWM coefficients", path, "ParseDwmData"));
   }
 
   std::vector<float> coeff;
   if (!UnpackRecordArray<float>(rec, coeff)) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "invalid DWM coefficient payload", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "invalid DWM coefficient payload", path, "ParseDwmData"));
   }
 
   if (coeff.size() != static_cast<std::size_t>(out.nterm)) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "DWM coefficient count mismatch", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "DWM coefficient count mismatch", path, "ParseDwmData"));
   }
 
-  if (!ReadFortranRecordRaw(in, rec)) {
+  if (!in.Next(rec)) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "failed reading DWM transition width", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "failed reading DWM transition width", path, "ParseDwmData"));
   }
 
   if (!UnpackRecordScalar<float>(rec, out.twidth)) {
     return Result<DwmData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "invalid DWM transition width payload", path.string(), "LoadDwmData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "invalid DWM transition width payload", path, "ParseDwmData"));
   }
 
   out.termarr_flat = std::move(termarr);
   out.coeff = std::move(coeff);
+  if (!DwmTermIndicesValid(out)) {
+    return Result<DwmData, Error>::Err(
+        MakeError(ErrorCode::kDataFileParseFailed, "DWM termarr index out of range", path, "ParseDwmData"));
+  }
   return Result<DwmData, Error>::Ok(std::move(out));
 }
 
+bool DwmTermIndicesValid(const DwmData& dwm) {
+  const int nvshterm = DwmVshTermCount(dwm.nmax, dwm.mmax);
+  for (std::size_t i = 0; i + 2 < dwm.termarr_flat.size(); i += 3) {
+    const std::int32_t vsh = dwm.termarr_flat[i];
+    const std::int32_t kp = dwm.termarr_flat[i + 1];
+    if ((vsh != kDwmNoTerm && (vsh < 0 || vsh >= nvshterm)) || (kp != kDwmNoTerm && (kp < 0 || kp > 2))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace hwm14::detail
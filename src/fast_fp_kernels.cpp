@@ -0,0 +1,49 @@
+/**
+ * @file fast_fp_kernels.cpp
+ * @brief Relaxed-FP evaluator kernels; built with `hwm14_apply_fast_fp_source_flags`.
+ *
+ * Keep this file free of inline functions and templates shared with strict translation units: an
+ * identical inline definition compiled here with different FP flags could be picked by the linker
+ * for the strict path as well.
+ */
+
+#include "hwm14/detail/fast_fp_kernels.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+// The target's /fp:precise stays on the command line (a second /fp: option is warning D9025), so relax
+// this file here. MSVC only fuses into FMA when the build targets it (/arch:AVX2).
+#pragma float_control(precise, off)
+#pragma fp_contract(on)
+#endif
+
+// Baseline x86-64 has no FMA: compile the kernels for it and bind them only on CPUs that have it.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HWM14_FAST_FP_TARGET __attribute__((target("fma")))
+#define HWM14_FAST_FP_CPU_CHECK 1
+#else
+#define HWM14_FAST_FP_TARGET
+#endif
+
+namespace hwm14::detail::fast_fp {
+
+bool Available() {
+#if defined(HWM14_FAST_FP_CPU_CHECK)
+  return __builtin_cpu_supports("fma") != 0;
+#else
+  return true;
+#endif
+}
+
+HWM14_FAST_FP_TARGET void QuietLevelSynth(const double* bz, const double* mcol, const double* tcol, int n, double& su,
+                                          double& sv) {
+  double u = 0.0;
+  double v = 0.0;
+  for (int k = 0; k < n; ++k) {
+    u += bz[k] * mcol[k];
+    v += bz[k] * tcol[k];
+  }
+  su = u;
+  sv = v;
+}
+
+}  // namespace hwm14::detail::fast_fp
@@ -6,31 +6,40 @@
 #include "hwm14/detail/gd2qd_loader.hpp"
 
 #include <cstring>
-#include <fstream>
+#include <string>
 #include <vector>
 
 #include "hwm14/detail/fortran_unformatted.hpp"
+#include "hwm14/detail/mapped_file.hpp"
 
 namespace hwm14::detail {
 
 Result<Gd2qdData, Error> LoadGd2qdData(const std::filesystem::path& path) {
-  std::ifstream in(path, std::ios::binary);
-  if (!in.is_open()) {
-    return Result<Gd2qdData, Error>::Err(
-        MakeError(ErrorCode::kDataFileOpenFailed, "failed to open gd2qd.dat", path.string(), "LoadGd2qdData"));
+  const auto file = MappedFile::Open(path);
+  if (!file) {
+    const bool open_failed = file.error().code == ErrorCode::kDataFileOpenFailed;
+    return Result<Gd2qdData, Error>::Err(MakeError(file.error().code,
+                                                   open_failed ? "failed to open gd2qd.dat" : file.error().message,
+                                                   path.string(),
+                                                   "LoadGd2qdData"));
   }
+  return ParseGd2qdData(file.value()->bytes(), path.string());
+}
 
-  std::vector<char> rec;
-  if (!ReadFortranRecordRaw(in, rec)) {
+Result<Gd2qdData, Error> ParseGd2qdData(std::span<const std::byte> bytes, std::string_view source) {
+  const std::string path(source);
+  FortranRecordCursor in(bytes);
+  std::span<const std::byte> rec;
+  if (!in.Next(rec)) {
     return Result<Gd2qdData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "failed reading gd2qd header record", path.string(), "LoadGd2qdData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "failed reading gd2qd header record", path, "ParseGd2qdData"));
   }
 
   if (rec.size() != (3 * sizeof(std::int32_t) + 2 * sizeof(float))) {
     return Result<Gd2qdData, Error>::Err(MakeError(ErrorCode::kDataFileParseFailed,
                                                     "unexpected gd2qd header size",
-                                                    path.string(),
-                                                    "LoadGd2qdData"));
+                                                    path,
+                                                    "ParseGd2qdData"));
   }
 
   Gd2qdData out;
@@ -48,27 +57,27 @@ Result<Gd2qdData, Error> LoadGd2qdData(const std::filesystem::path& path) {
   if (out.nmax < 0 || out.mmax < 0 || out.nterm <= 0 || out.nterm > 200000) {
     return Result<Gd2qdData, Error>::Err(MakeError(ErrorCode::kDataFileParseFailed,
                                                     "invalid gd2qd dimensions",
-                                                    path.string(),
-                                                    "LoadGd2qdData"));
+                                                    path,
+                                                    "ParseGd2qdData"));
   }
 
-  if (!ReadFortranRecordRaw(in, rec)) {
+  if (!in.Next(rec)) {
     return Result<Gd2qdData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "failed reading gd2qd coeff record", path.string(), "LoadGd2qdData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "failed reading gd2qd coeff record", path, "ParseGd2qdData"));
   }
 
   std::vector<double> coeff;
   if (!UnpackRecordArray<double>(rec, coeff)) {
     return Result<Gd2qdData, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "invalid gd2qd coeff payload", path.string(), "LoadGd2qdData"));
+        MakeError(ErrorCode::kDataFileParseFailed, "invalid gd2qd coeff payload", path, "ParseGd2qdData"));
   }
 
   const std::size_t expected = static_cast<std::size_t>(out.nterm) * 3U;
   if (coeff.size() != expected) {
     return Result<Gd2qdData, Error>::Err(MakeError(ErrorCode::kDataFileParseFailed,
                                                     "gd2qd coeff count mismatch",
-                                                    path.string(),
-                                                    "LoadGd2qdData"));
+                                                    path,
+                                                    "ParseGd2qdData"));
   }
 
   out.coeff_flat = std::move(coeff);
@@ -7,16 +7,33 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "hwm14/detail/cubic_weights.hpp"
 #include "hwm14/detail/dwm_loader.hpp"
+#include "hwm14/detail/embedded_data.hpp"
+#include "hwm14/detail/fast_fp_kernels.hpp"
 #include "hwm14/detail/gd2qd_loader.hpp"
 #include "hwm14/detail/hwm_bin_loader.hpp"
+#include "hwm14/detail/mapped_file.hpp"
+#include "hwm14/detail/model_blob.hpp"
+#include "hwm14/detail/model_impl.hpp"
 #include "hwm14/detail/time_utils.hpp"
 
 namespace hwm14 {
@@ -30,13 +47,9 @@ constexpr double kDtor = kPi / 180.0;
 constexpr double kSineps = 0.39781868;
 constexpr double kQwmScaleHeightKm = 60.0;
 
-inline std::size_t Idx2(int n, int m, int mmax) {
-  return static_cast<std::size_t>(n) * static_cast<std::size_t>(mmax + 1) + static_cast<std::size_t>(m);
-}
-
-inline std::size_t HwmOrderIdx(int c0, int level, int ncomp) {
-  return static_cast<std::size_t>(c0) + static_cast<std::size_t>(ncomp) * static_cast<std::size_t>(level);
-}
+using detail::AlfState;
+using detail::HwmOrderIdx;
+using detail::Idx2;
 
 inline double DotN(const double* a, const double* b, int n) {
   double out = 0.0;
@@ -46,99 +59,35 @@ inline double DotN(const double* a, const double* b, int n) {
   return out;
 }
 
-inline double Clamp(double x, double lo, double hi) {
-  return std::max(lo, std::min(hi, x));
-}
-
-struct AlfState {
-  int nmax0{0};
-  int mmax0{0};
-  std::vector<double> anm;
-  std::vector<double> bnm;
-  std::vector<double> dnm;
-  std::vector<double> cm;
-  std::vector<double> en;
-  std::vector<double> marr;
-  std::vector<double> narr;
-
-  [[nodiscard]] double Anm(int n, int m) const { return anm[Idx2(n, m, mmax0)]; }
-  [[nodiscard]] double Bnm(int n, int m) const { return bnm[Idx2(n, m, mmax0)]; }
-  [[nodiscard]] double Dnm(int n, int m) const { return dnm[Idx2(n, m, mmax0)]; }
-
-  void Init(int nmax, int mmax) {
-    nmax0 = nmax;
-    mmax0 = mmax;
-    anm.assign(static_cast<std::size_t>(nmax0 + 1) * static_cast<std::size_t>(mmax0 + 1), 0.0);
-    bnm.assign(static_cast<std::size_t>(nmax0 + 1) * static_cast<std::size_t>(mmax0 + 1), 0.0);
-    dnm.assign(static_cast<std::size_t>(nmax0 + 1) * static_cast<std::size_t>(mmax0 + 1), 0.0);
-    cm.assign(static_cast<std::size_t>(mmax0 + 1), 0.0);
-    en.assign(static_cast<std::size_t>(nmax0 + 1), 0.0);
-    marr.assign(static_cast<std::size_t>(mmax0 + 1), 0.0);
-    narr.assign(static_cast<std::size_t>(nmax0 + 1), 0.0);
-
-    for (int n = 1; n <= nmax0; ++n) {
-      narr[static_cast<std::size_t>(n)] = static_cast<double>(n);
-      en[static_cast<std::size_t>(n)] = std::sqrt(static_cast<double>(n * (n + 1)));
-      anm[Idx2(n, 0, mmax0)] =
-          std::sqrt(static_cast<double>((2 * n - 1) * (2 * n + 1))) / narr[static_cast<std::size_t>(n)];
-      bnm[Idx2(n, 0, mmax0)] =
-          std::sqrt(static_cast<double>((2 * n + 1) * (n - 1) * (n - 1)) / static_cast<double>(2 * n - 3)) /
-          narr[static_cast<std::size_t>(n)];
-    }
-
-    for (int m = 1; m <= mmax0; ++m) {
-      marr[static_cast<std::size_t>(m)] = static_cast<double>(m);
-      cm[static_cast<std::size_t>(m)] = std::sqrt(static_cast<double>(2 * m + 1) / static_cast<double>(2 * m * m * (m + 1)));
-      for (int n = m + 1; n <= nmax0; ++n) {
-        anm[Idx2(n, m, mmax0)] = std::sqrt(static_cast<double>((2 * n - 1) * (2 * n + 1) * (n - 1)) /
-                                           static_cast<double>((n - m) * (n + m) * (n + 1)));
-        bnm[Idx2(n, m, mmax0)] =
-            std::sqrt(static_cast<double>((2 * n + 1) * (n + m - 1) * (n - m - 1) * (n - 2) * (n - 1)) /
-                      static_cast<double>((n - m) * (n + m) * (2 * n - 3) * n * (n + 1)));
-        dnm[Idx2(n, m, mmax0)] = std::sqrt(static_cast<double>((n - m) * (n + m) * (2 * n + 1) * (n - 1)) /
-                                           static_cast<double>((2 * n - 1) * (n + 1)));
-      }
-    }
-  }
-
-  void Basis(int nmax, int mmax, double theta, std::vector<double>& P, std::vector<double>& V, std::vector<double>& W) const {
-    P.assign(static_cast<std::size_t>(nmax + 1) * static_cast<std::size_t>(mmax + 1), 0.0);
-    V.assign(static_cast<std::size_t>(nmax + 1) * static_cast<std::size_t>(mmax + 1), 0.0);
-    W.assign(static_cast<std::size_t>(nmax + 1) * static_cast<std::size_t>(mmax + 1), 0.0);
-
-    constexpr double p00 = 0.70710678118654746;
-    P[Idx2(0, 0, mmax)] = p00;
-    const double x = std::cos(theta);
-    const double y = std::sin(theta);
-
-    for (int m = 1; m <= mmax; ++m) {
-      W[Idx2(m, m, mmax)] = cm[static_cast<std::size_t>(m)] * P[Idx2(m - 1, m - 1, mmax)];
-      P[Idx2(m, m, mmax)] = y * en[static_cast<std::size_t>(m)] * W[Idx2(m, m, mmax)];
-      for (int n = m + 1; n <= nmax; ++n) {
-        W[Idx2(n, m, mmax)] = Anm(n, m) * x * W[Idx2(n - 1, m, mmax)] - Bnm(n, m) * W[Idx2(n - 2, m, mmax)];
-        P[Idx2(n, m, mmax)] = y * en[static_cast<std::size_t>(n)] * W[Idx2(n, m, mmax)];
-        V[Idx2(n, m, mmax)] = narr[static_cast<std::size_t>(n)] * x * W[Idx2(n, m, mmax)] - Dnm(n, m) * W[Idx2(n - 1, m, mmax)];
-        W[Idx2(n - 2, m, mmax)] = marr[static_cast<std::size_t>(m)] * W[Idx2(n - 2, m, mmax)];
-      }
-      W[Idx2(nmax - 1, m, mmax)] = marr[static_cast<std::size_t>(m)] * W[Idx2(nmax - 1, m, mmax)];
-      W[Idx2(nmax, m, mmax)] = marr[static_cast<std::size_t>(m)] * W[Idx2(nmax, m, mmax)];
-      V[Idx2(m, m, mmax)] = x * W[Idx2(m, m, mmax)];
-    }
-
-    if (nmax >= 1) {
-      P[Idx2(1, 0, mmax)] = Anm(1, 0) * x * P[Idx2(0, 0, mmax)];
-      if (mmax >= 1) {
-        V[Idx2(1, 0, mmax)] = -P[Idx2(1, 1, mmax)];
+// Float32 dot product with double accumulation across blocks: eight independent float lanes keep the
+// inner loop vectorizable at twice the double width, and each 64-term block is folded into a double
+// so rounding error does not grow with the level's term count.
+inline double DotNF(const float* a, const float* b, int n) {
+  constexpr int kLanes = 8;
+  constexpr int kBlock = 64;
+  double out = 0.0;
+  int i = 0;
+  while (i + kLanes <= n) {
+    std::array<float, kLanes> acc{};
+    const int end = std::min(n, i + kBlock) - kLanes;
+    for (; i <= end; i += kLanes) {
+      for (int j = 0; j < kLanes; ++j) {
+        acc[static_cast<std::size_t>(j)] += a[i + j] * b[i + j];
       }
     }
-    for (int n = 2; n <= nmax; ++n) {
-      P[Idx2(n, 0, mmax)] = Anm(n, 0) * x * P[Idx2(n - 1, 0, mmax)] - Bnm(n, 0) * P[Idx2(n - 2, 0, mmax)];
-      if (mmax >= 1) {
-        V[Idx2(n, 0, mmax)] = -P[Idx2(n, 1, mmax)];
-      }
+    for (const float x : acc) {
+      out += static_cast<double>(x);
     }
   }
-};
+  for (; i < n; ++i) {
+    out += static_cast<double>(a[i] * b[i]);
+  }
+  return out;
+}
+
+inline double Clamp(double x, double lo, double hi) {
+  return std::max(lo, std::min(hi, x));
+}
 
 double Ap2Kp(double ap0) {
   static constexpr std::array<float, 28> apgrid = {0.F,  2.F,  3.F,  4.F,  5.F,  6.F,  7.F,  9.F,  12.F, 15.F,
@@ -264,14 +213,19 @@ double BSpline(int p, int m, const std::vector<double>& V, int i, double u) {
   return N[0];
 }
 
+// First of the `p + 1` vertical levels active at `alt`.
+int VertLevel(double alt, const detail::HwmBinHeader& hwm) {
+  const int iz = FindSpan(hwm.nnode - hwm.p - 1, hwm.p, alt, hwm.vnode) - hwm.p;
+  return std::min(iz, 26);
+}
+
 void VertWght(double alt, const detail::HwmBinHeader& hwm, std::vector<double>& wght, int& iz) {
   const int p = hwm.p;
   const int nnode = hwm.nnode;
   const int nlev = hwm.nlev;
   wght.assign(static_cast<std::size_t>(p + 1), 0.0);
 
-  iz = FindSpan(nnode - p - 1, p, alt, hwm.vnode) - p;
-  iz = std::min(iz, 26);
+  iz = VertLevel(alt, hwm);
 
   wght[0] = BSpline(p, nnode, hwm.vnode, iz, alt);
   wght[1] = BSpline(p, nnode, hwm.vnode, iz + 1, alt);
@@ -296,13 +250,10 @@ void VertWght(double alt, const detail::HwmBinHeader& hwm, std::vector<double>&
   wght[3] = std::inner_product(we.begin(), we.end(), hwm.e2.begin(), 0.0);
 }
 
-void ParityColumn(const std::array<int, 8>& order,
-                  int nb,
-                  std::vector<double>& mcol,
-                  std::vector<double>& tcol,
-                  int nbf) {
-  (void)nb;
-  tcol.assign(static_cast<std::size_t>(nbf), 0.0);
+// Splits one level's raw coefficients in place: `mcol` keeps the zonal part and `tcol` receives the
+// meridional part. Both spans cover the level's `nbf` entries.
+void ParityColumn(const std::array<int, 8>& order, std::span<double> mcol, std::span<double> tcol) {
+  std::fill(tcol.begin(), tcol.end(), 0.0);
 
   const int amaxs = order[0];
   const int amaxn = order[1];
@@ -391,6 +342,57 @@ void ParityColumn(const std::array<int, 8>& order,
   }
 }
 
+// Applies ParityColumn to every level of a raw `mparm` array in place and writes the matching `tparm`.
+// The array holds consecutive levels starting at `first_level`. Levels are independent, so
+// `workers > 1` splits them into contiguous ranges run concurrently.
+void DeriveParityColumns(const detail::HwmBinHeader& h,
+                         std::vector<double>& mparm,
+                         std::vector<double>& tparm,
+                         int workers = 1,
+                         int first_level = 0) {
+  tparm.assign(mparm.size(), 0.0);
+  const auto nbf = static_cast<std::size_t>(h.nbf);
+  const int held = static_cast<int>(mparm.size() / nbf);
+  const int last_level = std::min(h.nlev - h.p - 1, first_level + held - 1);
+  const auto derive_levels = [&](int first, int last) {
+    for (int i = first; i <= last; ++i) {
+      std::array<int, 8> order{};
+      for (int k = 0; k < 8; ++k) {
+        order[static_cast<std::size_t>(k)] = h.order[HwmOrderIdx(k, i, h.ncomp)];
+      }
+      const std::size_t off = nbf * static_cast<std::size_t>(i - first_level);
+      ParityColumn(order, std::span<double>(mparm).subspan(off, nbf), std::span<double>(tparm).subspan(off, nbf));
+    }
+  };
+
+  const int levels = last_level - first_level + 1;
+  workers = std::clamp(workers, 1, std::max(levels, 1));
+  if (workers == 1) {
+    derive_levels(first_level, last_level);
+    return;
+  }
+  std::vector<std::future<void>> tasks;
+  const int per = (levels + workers - 1) / workers;
+  for (int first = first_level + per; first <= last_level; first += per) {
+    tasks.push_back(std::async(std::launch::async | std::launch::deferred, derive_levels, first,
+                               std::min(first + per - 1, last_level)));
+  }
+  derive_levels(first_level, std::min(first_level + per - 1, last_level));
+  for (auto& t : tasks) {
+    t.get();
+  }
+}
+
+// Inclusive range of B-spline levels `VertWght` can touch for altitudes in `band`.
+std::pair<int, int> BandLevels(const detail::HwmBinHeader& h, const AltitudeBand& band) {
+  std::vector<double> wght;
+  int lo = 0;
+  int hi = 0;
+  VertWght(band.min_km, h, wght, lo);
+  VertWght(band.max_km, h, wght, hi);
+  return {lo, std::min(hi + h.p, h.nlev)};
+}
+
 struct Gd2qdTransform {
   double qlat{};
   double qlon{};
@@ -402,27 +404,6 @@ struct Gd2qdTransform {
 
 }  // namespace
 
-struct Model::Impl {
-  DataPaths paths{};
-  detail::HwmBinHeader hwm{};
-  detail::Gd2qdData gd2qd{};
-  detail::DwmData dwm{};
-
-  int maxo{};
-  int nmaxgeo{};
-  int mmaxgeo{};
-  int nvshterm{};
-
-  AlfState alf{};
-
-  std::vector<double> xcoeff{};
-  std::vector<double> ycoeff{};
-  std::vector<double> zcoeff{};
-  std::vector<double> normadj{};
-
-  std::vector<double> tparm{};  // [nbf x (nlev+1)]
-};
-
 namespace {
 
 Result<Winds, Error> ValidateCommonInputs(const Inputs& in, std::string_view where) {
@@ -447,173 +428,437 @@ Result<Winds, Error> ValidateCommonInputs(const Inputs& in, std::string_view whe
   return Result<Winds, Error>::Ok(Winds{});
 }
 
-Result<Winds, Error> QuietWindsImpl(const Model::Impl& impl, const Inputs& in) {
-  const auto& h = impl.hwm;
+// `ValidateCommonInputs` plus the loaded altitude band of `impl`, for every quiet-wind entry point.
+Result<Winds, Error> ValidateQuietInputs(const Model::Impl& impl, const Inputs& in, std::string_view where) {
+  auto valid = ValidateCommonInputs(in, where);
+  if (!valid || !impl.altitude_band) {
+    return valid;
+  }
+  if (in.altitude_km < impl.altitude_band->min_km || in.altitude_km > impl.altitude_band->max_km) {
+    return Result<Winds, Error>::Err(MakeError(ErrorCode::kInvalidInput,
+                                               "altitude_km outside the loaded Options::altitude_band",
+                                               std::to_string(in.altitude_km),
+                                               std::string(where)));
+  }
+  return valid;
+}
 
-  struct QuietScratch {
-    std::vector<double> fs;
-    std::vector<double> fm;
-    std::vector<double> fl;
-    std::vector<double> gpbar;
-    std::vector<double> gvbar;
-    std::vector<double> gwbar;
-    std::vector<double> zwght;
-    std::vector<double> bz;
+// Rejects malformed `Options::altitude_band` values before any file is parsed.
+std::optional<Error> ValidateAltitudeBand(const Options& options, std::string_view where) {
+  if (!options.altitude_band) {
+    return std::nullopt;
+  }
+  const auto& band = *options.altitude_band;
+  if (!std::isfinite(band.min_km) || !std::isfinite(band.max_km) || band.min_km < 0.0 || band.max_km > 5000.0 ||
+      band.min_km > band.max_km) {
+    return MakeError(ErrorCode::kInvalidInput,
+                     "altitude_band must satisfy 0 <= min_km <= max_km <= 5000",
+                     std::to_string(band.min_km) + ", " + std::to_string(band.max_km),
+                     std::string(where));
+  }
+  return std::nullopt;
+}
+
+// Evaluates P, V, W for `(nmax, mmax)`, using a fixed-dimension kernel of `tables` (the quiet `Impl`
+// or the `DisturbanceTables`) when one matches and the generic recurrence otherwise. Both produce
+// identical tables.
+template <typename Tables>
+void AlfBasis(const Tables& tables,
+              int nmax,
+              int mmax,
+              double theta,
+              std::vector<double>& P,
+              std::vector<double>& V,
+              std::vector<double>& W) {
+  const auto fixed = [&](const auto& kernel) {
+    P.resize(kernel.kSize);
+    V.resize(kernel.kSize);
+    W.resize(kernel.kSize);
+    kernel.Basis(theta, P.data(), V.data(), W.data());
   };
-  thread_local QuietScratch scratch;
+  if (tables.alf84 && nmax == detail::FixedAlf84::kNmax && mmax == detail::FixedAlf84::kMmax) {
+    fixed(*tables.alf84);
+    return;
+  }
+  if constexpr (requires { tables.alf103; }) {
+    if (tables.alf103 && nmax == detail::FixedAlf103::kNmax && mmax == detail::FixedAlf103::kMmax) {
+      fixed(*tables.alf103);
+      return;
+    }
+  }
+  tables.alf.Basis(nmax, mmax, theta, P, V, W);
+}
+
+// Per-thread quiet buffers. The inherited harmonics are those `PrepareQuietBasis` filled; the level
+// sums take the harmonics separately so `QuietWindsWithHarmonics` can pass a caller's without copying.
+struct QuietScratch : detail::QuietHarmonics {
+  std::vector<double> gpbar;
+  std::vector<double> gvbar;
+  std::vector<double> gwbar;
+  std::vector<double> zwght;
+  std::vector<double> bz;
+  std::vector<float> bzf;
+  int lev{};
+};
 
-  scratch.fs.assign(static_cast<std::size_t>(h.maxs + 1) * 2U, 0.0);
-  scratch.fm.assign(static_cast<std::size_t>(h.maxm + 1) * 2U, 0.0);
-  scratch.fl.assign(static_cast<std::size_t>(h.maxl + 1) * 2U, 0.0);
+QuietScratch& ThreadQuietScratch() {
+  thread_local QuietScratch scratch;
+  return scratch;
+}
 
+// {cos, sin} of s * day angle, s = 0..maxs.
+void FillSeasonalHarmonics(const detail::HwmBinHeader& h, const Inputs& in, std::vector<double>& fs) {
+  fs.assign(static_cast<std::size_t>(h.maxs + 1) * 2U, 0.0);
   const double day = static_cast<double>(in.yyddd % 1000);
-  double aa = day * kTwoPi / 365.25;
+  const double aa = day * kTwoPi / 365.25;
   for (int s = 0; s <= h.maxs; ++s) {
     const double bb = static_cast<double>(s) * aa;
-    scratch.fs[static_cast<std::size_t>(2 * s)] = std::cos(bb);
-    scratch.fs[static_cast<std::size_t>(2 * s + 1)] = std::sin(bb);
+    fs[static_cast<std::size_t>(2 * s)] = std::cos(bb);
+    fs[static_cast<std::size_t>(2 * s + 1)] = std::sin(bb);
   }
+}
 
+// {cos, sin} of l * solar local-time angle, l = 0..maxl.
+void FillLocalTimeHarmonics(const detail::HwmBinHeader& h, const Inputs& in, std::vector<double>& fl) {
+  fl.assign(static_cast<std::size_t>(h.maxl + 1) * 2U, 0.0);
   const double stl = std::fmod(in.ut_seconds / 3600.0 + in.geodetic_lon_deg / 15.0 + 48.0, 24.0);
-  aa = stl * kTwoPi / 24.0;
+  const double aa = stl * kTwoPi / 24.0;
   for (int l = 0; l <= h.maxl; ++l) {
     const double cc = static_cast<double>(l) * aa;
-    scratch.fl[static_cast<std::size_t>(2 * l)] = std::cos(cc);
-    scratch.fl[static_cast<std::size_t>(2 * l + 1)] = std::sin(cc);
+    fl[static_cast<std::size_t>(2 * l)] = std::cos(cc);
+    fl[static_cast<std::size_t>(2 * l + 1)] = std::sin(cc);
   }
+}
 
-  aa = in.geodetic_lon_deg * kDeg2Rad;
+// {cos, sin} of m * longitude, m = 0..maxm.
+void FillLongitudeHarmonics(const detail::HwmBinHeader& h, const Inputs& in, std::vector<double>& fm) {
+  fm.assign(static_cast<std::size_t>(h.maxm + 1) * 2U, 0.0);
+  const double aa = in.geodetic_lon_deg * kDeg2Rad;
   for (int m = 0; m <= h.maxm; ++m) {
     const double bb = static_cast<double>(m) * aa;
-    scratch.fm[static_cast<std::size_t>(2 * m)] = std::cos(bb);
-    scratch.fm[static_cast<std::size_t>(2 * m + 1)] = std::sin(bb);
+    fm[static_cast<std::size_t>(2 * m)] = std::cos(bb);
+    fm[static_cast<std::size_t>(2 * m + 1)] = std::sin(bb);
   }
+}
 
+// sin(n * colatitude), n = 0..maxn.
+void FillColatitudeSines(const detail::HwmBinHeader& h, const Inputs& in, std::vector<double>& sn) {
+  sn.assign(static_cast<std::size_t>(h.maxn + 1), 0.0);
   const double theta = (90.0 - in.geodetic_lat_deg) * kDeg2Rad;
-  impl.alf.Basis(h.maxn, impl.maxo, theta, scratch.gpbar, scratch.gvbar, scratch.gwbar);
+  for (int n = 0; n <= h.maxn; ++n) {
+    sn[static_cast<std::size_t>(n)] = std::sin(static_cast<double>(n) * theta);
+  }
+}
 
-  int lev = 0;
-  VertWght(in.altitude_km, h, scratch.zwght, lev);
+// Computes the position-dependent pieces shared by every active level: the ALF basis at the input
+// colatitude and the vertical B-spline weights.
+void PrepareQuietLocation(const Model::Impl& impl, const Inputs& in, QuietScratch& scratch) {
+  const auto& h = impl.hwm;
+  const double theta = (90.0 - in.geodetic_lat_deg) * kDeg2Rad;
+  AlfBasis(impl, h.maxn, impl.maxo, theta, scratch.gpbar, scratch.gvbar, scratch.gwbar);
 
+  VertWght(in.altitude_km, h, scratch.zwght, scratch.lev);
   scratch.bz.assign(static_cast<std::size_t>(h.nbf), 0.0);
-  static constexpr std::array<double, 4> wavefactor = {0.0, 1.0, 1.0, 1.0};
-  static constexpr std::array<double, 4> tidefactor = {0.0, 1.0, 1.0, 1.0};
+}
 
-  double u = 0.0;
-  double v = 0.0;
+// Computes the point-dependent pieces shared by every active level: seasonal/local-time/longitude
+// harmonics, sin(n * theta), the ALF basis at the input colatitude, and the vertical B-spline weights.
+void PrepareQuietBasis(const Model::Impl& impl, const Inputs& in, QuietScratch& scratch) {
+  detail::FillQuietHarmonics(impl, in, scratch);
+  PrepareQuietLocation(impl, in, scratch);
+}
 
-  for (int b = 0; b <= h.p; ++b) {
-    if (scratch.zwght[static_cast<std::size_t>(b)] == 0.0) {
-      continue;
-    }
+detail::QuietLevelArgs LevelArgs(const detail::QuietHarmonics& hm, const QuietScratch& scratch) {
+  return {hm.fs.data(), hm.fm.data(), hm.fl.data(), scratch.gvbar.data(), scratch.gwbar.data(), hm.sn.data()};
+}
 
-    const int d = b + lev;
-    int c = 1;
+// Active term count of a filled basis row, and the generated kernel that filled it (null for the loops).
+struct QuietLevelFill {
+  int terms{};
+  const detail::QuietLevelKernel* kernel{};
+};
+
+// Fills `scratch.bz` with the basis row of level `d` from the harmonics `hm` and the ALF basis in
+// `scratch`, with its generated kernel when bound and the generic loops otherwise. The only place that
+// chooses between the two.
+QuietLevelFill FillQuietLevelBasis(const Model::Impl& impl,
+                                   int d,
+                                   const detail::QuietHarmonics& hm,
+                                   QuietScratch& scratch) {
+  if (static_cast<std::size_t>(d) < impl.quiet_levels.size()) {
+    const auto& kernel = impl.quiet_levels[static_cast<std::size_t>(d)];
+    return {kernel.fill(LevelArgs(hm, scratch), scratch.bz.data()), &kernel};
+  }
+
+  const auto& h = impl.hwm;
+  static constexpr std::array<double, 4> wavefactor = {0.0, 1.0, 1.0, 1.0};
+  static constexpr std::array<double, 4> tidefactor = {0.0, 1.0, 1.0, 1.0};
 
-    const int amaxs = h.order[HwmOrderIdx(0, d, h.ncomp)];
-    const int amaxn = h.order[HwmOrderIdx(1, d, h.ncomp)];
-    const int pmaxm = h.order[HwmOrderIdx(2, d, h.ncomp)];
-    const int pmaxs = h.order[HwmOrderIdx(3, d, h.ncomp)];
-    const int pmaxn = h.order[HwmOrderIdx(4, d, h.ncomp)];
-    const int tmaxl = h.order[HwmOrderIdx(5, d, h.ncomp)];
-    const int tmaxs = h.order[HwmOrderIdx(6, d, h.ncomp)];
-    const int tmaxn = h.order[HwmOrderIdx(7, d, h.ncomp)];
+  int c = 1;
 
+  const int amaxs = h.order[HwmOrderIdx(0, d, h.ncomp)];
+  const int amaxn = h.order[HwmOrderIdx(1, d, h.ncomp)];
+  const int pmaxm = h.order[HwmOrderIdx(2, d, h.ncomp)];
+  const int pmaxs = h.order[HwmOrderIdx(3, d, h.ncomp)];
+  const int pmaxn = h.order[HwmOrderIdx(4, d, h.ncomp)];
+  const int tmaxl = h.order[HwmOrderIdx(5, d, h.ncomp)];
+  const int tmaxs = h.order[HwmOrderIdx(6, d, h.ncomp)];
+  const int tmaxn = h.order[HwmOrderIdx(7, d, h.ncomp)];
+
+  for (int n = 1; n <= amaxn; ++n) {
+    const double sc = hm.sn[static_cast<std::size_t>(n)];
+    scratch.bz[static_cast<std::size_t>(c - 1)] = -sc;
+    scratch.bz[static_cast<std::size_t>(c)] = sc;
+    c += 2;
+  }
+  for (int s = 1; s <= amaxs; ++s) {
+    const double cs = hm.fs[static_cast<std::size_t>(2 * s)];
+    const double ss = hm.fs[static_cast<std::size_t>(2 * s + 1)];
     for (int n = 1; n <= amaxn; ++n) {
-      const double sc = std::sin(static_cast<double>(n) * theta);
-      scratch.bz[static_cast<std::size_t>(c - 1)] = -sc;
-      scratch.bz[static_cast<std::size_t>(c)] = sc;
-      c += 2;
-    }
-    for (int s = 1; s <= amaxs; ++s) {
-      const double cs = scratch.fs[static_cast<std::size_t>(2 * s)];
-      const double ss = scratch.fs[static_cast<std::size_t>(2 * s + 1)];
-      for (int n = 1; n <= amaxn; ++n) {
-        const double sc = std::sin(static_cast<double>(n) * theta);
-        scratch.bz[static_cast<std::size_t>(c - 1)] = -sc * cs;
-        scratch.bz[static_cast<std::size_t>(c)] = sc * ss;
-        scratch.bz[static_cast<std::size_t>(c + 1)] = sc * cs;
-        scratch.bz[static_cast<std::size_t>(c + 2)] = -sc * ss;
-        c += 4;
-      }
+      const double sc = hm.sn[static_cast<std::size_t>(n)];
+      scratch.bz[static_cast<std::size_t>(c - 1)] = -sc * cs;
+      scratch.bz[static_cast<std::size_t>(c)] = sc * ss;
+      scratch.bz[static_cast<std::size_t>(c + 1)] = sc * cs;
+      scratch.bz[static_cast<std::size_t>(c + 2)] = -sc * ss;
+      c += 4;
     }
+  }
 
-    for (int m = 1; m <= pmaxm; ++m) {
-      const double cm = scratch.fm[static_cast<std::size_t>(2 * m)] * wavefactor[static_cast<std::size_t>(m)];
-      const double sm = scratch.fm[static_cast<std::size_t>(2 * m + 1)] * wavefactor[static_cast<std::size_t>(m)];
+  for (int m = 1; m <= pmaxm; ++m) {
+    const double cm = hm.fm[static_cast<std::size_t>(2 * m)] * wavefactor[static_cast<std::size_t>(m)];
+    const double sm = hm.fm[static_cast<std::size_t>(2 * m + 1)] * wavefactor[static_cast<std::size_t>(m)];
+    for (int n = m; n <= pmaxn; ++n) {
+      const double vb = scratch.gvbar[Idx2(n, m, impl.maxo)];
+      const double wb = scratch.gwbar[Idx2(n, m, impl.maxo)];
+      scratch.bz[static_cast<std::size_t>(c - 1)] = -vb * cm;
+      scratch.bz[static_cast<std::size_t>(c)] = vb * sm;
+      scratch.bz[static_cast<std::size_t>(c + 1)] = -wb * sm;
+      scratch.bz[static_cast<std::size_t>(c + 2)] = -wb * cm;
+      c += 4;
+    }
+    for (int s = 1; s <= pmaxs; ++s) {
+      const double cs = hm.fs[static_cast<std::size_t>(2 * s)];
+      const double ss = hm.fs[static_cast<std::size_t>(2 * s + 1)];
       for (int n = m; n <= pmaxn; ++n) {
         const double vb = scratch.gvbar[Idx2(n, m, impl.maxo)];
         const double wb = scratch.gwbar[Idx2(n, m, impl.maxo)];
-        scratch.bz[static_cast<std::size_t>(c - 1)] = -vb * cm;
-        scratch.bz[static_cast<std::size_t>(c)] = vb * sm;
-        scratch.bz[static_cast<std::size_t>(c + 1)] = -wb * sm;
-        scratch.bz[static_cast<std::size_t>(c + 2)] = -wb * cm;
-        c += 4;
-      }
-      for (int s = 1; s <= pmaxs; ++s) {
-        const double cs = scratch.fs[static_cast<std::size_t>(2 * s)];
-        const double ss = scratch.fs[static_cast<std::size_t>(2 * s + 1)];
-        for (int n = m; n <= pmaxn; ++n) {
-          const double vb = scratch.gvbar[Idx2(n, m, impl.maxo)];
-          const double wb = scratch.gwbar[Idx2(n, m, impl.maxo)];
-          scratch.bz[static_cast<std::size_t>(c - 1)] = -vb * cm * cs;
-          scratch.bz[static_cast<std::size_t>(c)] = vb * sm * cs;
-          scratch.bz[static_cast<std::size_t>(c + 1)] = -wb * sm * cs;
-          scratch.bz[static_cast<std::size_t>(c + 2)] = -wb * cm * cs;
-          scratch.bz[static_cast<std::size_t>(c + 3)] = -vb * cm * ss;
-          scratch.bz[static_cast<std::size_t>(c + 4)] = vb * sm * ss;
-          scratch.bz[static_cast<std::size_t>(c + 5)] = -wb * sm * ss;
-          scratch.bz[static_cast<std::size_t>(c + 6)] = -wb * cm * ss;
-          c += 8;
-        }
+        scratch.bz[static_cast<std::size_t>(c - 1)] = -vb * cm * cs;
+        scratch.bz[static_cast<std::size_t>(c)] = vb * sm * cs;
+        scratch.bz[static_cast<std::size_t>(c + 1)] = -wb * sm * cs;
+        scratch.bz[static_cast<std::size_t>(c + 2)] = -wb * cm * cs;
+        scratch.bz[static_cast<std::size_t>(c + 3)] = -vb * cm * ss;
+        scratch.bz[static_cast<std::size_t>(c + 4)] = vb * sm * ss;
+        scratch.bz[static_cast<std::size_t>(c + 5)] = -wb * sm * ss;
+        scratch.bz[static_cast<std::size_t>(c + 6)] = -wb * cm * ss;
+        c += 8;
       }
     }
+  }
 
-    for (int l = 1; l <= tmaxl; ++l) {
-      const double cl = scratch.fl[static_cast<std::size_t>(2 * l)] * tidefactor[static_cast<std::size_t>(l)];
-      const double sl = scratch.fl[static_cast<std::size_t>(2 * l + 1)] * tidefactor[static_cast<std::size_t>(l)];
+  for (int l = 1; l <= tmaxl; ++l) {
+    const double cl = hm.fl[static_cast<std::size_t>(2 * l)] * tidefactor[static_cast<std::size_t>(l)];
+    const double sl = hm.fl[static_cast<std::size_t>(2 * l + 1)] * tidefactor[static_cast<std::size_t>(l)];
+    for (int n = l; n <= tmaxn; ++n) {
+      const double vb = scratch.gvbar[Idx2(n, l, impl.maxo)];
+      const double wb = scratch.gwbar[Idx2(n, l, impl.maxo)];
+      scratch.bz[static_cast<std::size_t>(c - 1)] = -vb * cl;
+      scratch.bz[static_cast<std::size_t>(c)] = vb * sl;
+      scratch.bz[static_cast<std::size_t>(c + 1)] = -wb * sl;
+      scratch.bz[static_cast<std::size_t>(c + 2)] = -wb * cl;
+      c += 4;
+    }
+    for (int s = 1; s <= tmaxs; ++s) {
+      const double cs = hm.fs[static_cast<std::size_t>(2 * s)];
+      const double ss = hm.fs[static_cast<std::size_t>(2 * s + 1)];
       for (int n = l; n <= tmaxn; ++n) {
         const double vb = scratch.gvbar[Idx2(n, l, impl.maxo)];
         const double wb = scratch.gwbar[Idx2(n, l, impl.maxo)];
-        scratch.bz[static_cast<std::size_t>(c - 1)] = -vb * cl;
-        scratch.bz[static_cast<std::size_t>(c)] = vb * sl;
-        scratch.bz[static_cast<std::size_t>(c + 1)] = -wb * sl;
-        scratch.bz[static_cast<std::size_t>(c + 2)] = -wb * cl;
-        c += 4;
-      }
-      for (int s = 1; s <= tmaxs; ++s) {
-        const double cs = scratch.fs[static_cast<std::size_t>(2 * s)];
-        const double ss = scratch.fs[static_cast<std::size_t>(2 * s + 1)];
-        for (int n = l; n <= tmaxn; ++n) {
-          const double vb = scratch.gvbar[Idx2(n, l, impl.maxo)];
-          const double wb = scratch.gwbar[Idx2(n, l, impl.maxo)];
-          scratch.bz[static_cast<std::size_t>(c - 1)] = -vb * cl * cs;
-          scratch.bz[static_cast<std::size_t>(c)] = vb * sl * cs;
-          scratch.bz[static_cast<std::size_t>(c + 1)] = -wb * sl * cs;
-          scratch.bz[static_cast<std::size_t>(c + 2)] = -wb * cl * cs;
-          scratch.bz[static_cast<std::size_t>(c + 3)] = -vb * cl * ss;
-          scratch.bz[static_cast<std::size_t>(c + 4)] = vb * sl * ss;
-          scratch.bz[static_cast<std::size_t>(c + 5)] = -wb * sl * ss;
-          scratch.bz[static_cast<std::size_t>(c + 6)] = -wb * cl * ss;
-          c += 8;
-        }
+        scratch.bz[static_cast<std::size_t>(c - 1)] = -vb * cl * cs;
+        scratch.bz[static_cast<std::size_t>(c)] = vb * sl * cs;
+        scratch.bz[static_cast<std::size_t>(c + 1)] = -wb * sl * cs;
+        scratch.bz[static_cast<std::size_t>(c + 2)] = -wb * cl * cs;
+        scratch.bz[static_cast<std::size_t>(c + 3)] = -vb * cl * ss;
+        scratch.bz[static_cast<std::size_t>(c + 4)] = vb * sl * ss;
+        scratch.bz[static_cast<std::size_t>(c + 5)] = -wb * sl * ss;
+        scratch.bz[static_cast<std::size_t>(c + 6)] = -wb * cl * ss;
+        c += 8;
       }
     }
+  }
+
+  return {c - 1, nullptr};
+}
 
-    c -= 1;
-    const double* mcol = impl.hwm.mparm.data() + static_cast<std::size_t>(h.nbf) * static_cast<std::size_t>(d);
-    const double* tcol = impl.tparm.data() + static_cast<std::size_t>(h.nbf) * static_cast<std::size_t>(d);
-    u += scratch.zwght[static_cast<std::size_t>(b)] * DotN(scratch.bz.data(), mcol, c);
-    v += scratch.zwght[static_cast<std::size_t>(b)] * DotN(scratch.bz.data(), tcol, c);
+// Sums the active levels of a prepared `scratch` with harmonics `hm` against the double coefficients.
+Winds QuietLevelsSum(const Model::Impl& impl, const detail::QuietHarmonics& hm, QuietScratch& scratch) {
+  const auto& h = impl.hwm;
+  double u = 0.0;
+  double v = 0.0;
+
+  for (int b = 0; b <= h.p; ++b) {
+    if (scratch.zwght[static_cast<std::size_t>(b)] == 0.0) {
+      continue;
+    }
+
+    const int d = b + scratch.lev;
+    const auto col = static_cast<std::size_t>(h.nbf) * static_cast<std::size_t>(d - impl.level_first);
+    const double* mcol = impl.mparm.data() + col;
+    const double* tcol = impl.tparm.data() + col;
+    const auto fill = FillQuietLevelBasis(impl, d, hm, scratch);
+    double su = 0.0;
+    double sv = 0.0;
+    if (impl.fast_fp) {
+      detail::fast_fp::QuietLevelSynth(scratch.bz.data(), mcol, tcol, fill.terms, su, sv);
+    } else if (fill.kernel != nullptr) {
+      fill.kernel->synth(scratch.bz.data(), mcol, tcol, su, sv);
+    } else {
+      su = DotN(scratch.bz.data(), mcol, fill.terms);
+      sv = DotN(scratch.bz.data(), tcol, fill.terms);
+    }
+    u += scratch.zwght[static_cast<std::size_t>(b)] * su;
+    v += scratch.zwght[static_cast<std::size_t>(b)] * sv;
+  }
+
+  Winds w{};
+  w.meridional_mps = v;
+  w.zonal_mps = u;
+  return w;
+}
+
+// `QuietLevelsSum` against the float32 coefficient copies: the basis is still built in double and
+// rounded once per term, the dot products run in float lanes, and levels are combined in double.
+Winds QuietLevelsSumF32(const Model::Impl& impl, const detail::QuietHarmonics& hm, QuietScratch& scratch) {
+  const auto& h = impl.hwm;
+  scratch.bzf.resize(scratch.bz.size());
+
+  double u = 0.0;
+  double v = 0.0;
+  for (int b = 0; b <= h.p; ++b) {
+    const double wz = scratch.zwght[static_cast<std::size_t>(b)];
+    if (wz == 0.0) {
+      continue;
+    }
+
+    const int d = b + scratch.lev;
+    const int c = FillQuietLevelBasis(impl, d, hm, scratch).terms;
+    for (int k = 0; k < c; ++k) {
+      scratch.bzf[static_cast<std::size_t>(k)] = static_cast<float>(scratch.bz[static_cast<std::size_t>(k)]);
+    }
+    const auto col = static_cast<std::size_t>(h.nbf) * static_cast<std::size_t>(d - impl.level_first);
+    u += wz * DotNF(scratch.bzf.data(), impl.mparm_f32.data() + col, c);
+    v += wz * DotNF(scratch.bzf.data(), impl.tparm_f32.data() + col, c);
   }
 
   Winds w{};
   w.meridional_mps = v;
   w.zonal_mps = u;
-  return Result<Winds, Error>::Ok(w);
+  return w;
 }
 
-Result<Gd2qdTransform, Error> Gd2qdImpl(const Model::Impl& impl, double glat_in, double glon) {
+Result<Winds, Error> QuietWindsImpl(const Model::Impl& impl, const Inputs& in) {
+  auto& scratch = ThreadQuietScratch();
+  PrepareQuietBasis(impl, in, scratch);
+  return Result<Winds, Error>::Ok(QuietLevelsSum(impl, scratch, scratch));
+}
+
+Result<Winds, Error> QuietWindsF32Impl(const Model::Impl& impl, const Inputs& in) {
+  auto& scratch = ThreadQuietScratch();
+  PrepareQuietBasis(impl, in, scratch);
+  return Result<Winds, Error>::Ok(QuietLevelsSumF32(impl, scratch, scratch));
+}
+
+// `PrepareQuietBasis` for the next row of a scheduled batch. `prev` is the row this thread prepared
+// last (or null); pieces whose inputs are unchanged from it are kept as they are.
+void PrepareQuietBasisAfter(const Model::Impl& impl,
+                            const Inputs& in,
+                            const Inputs* prev,
+                            QuietScratch& scratch,
+                            BatchReuseReport& report) {
+  const auto& h = impl.hwm;
+  const bool same_lat = prev != nullptr && prev->geodetic_lat_deg == in.geodetic_lat_deg;
+  const bool same_lon = prev != nullptr && prev->geodetic_lon_deg == in.geodetic_lon_deg;
+  if (prev == nullptr || prev->yyddd % 1000 != in.yyddd % 1000) {
+    FillSeasonalHarmonics(h, in, scratch.fs);
+  }
+  if (!same_lon || prev->ut_seconds != in.ut_seconds) {
+    FillLocalTimeHarmonics(h, in, scratch.fl);
+  }
+  if (!same_lon) {
+    FillLongitudeHarmonics(h, in, scratch.fm);
+  }
+  if (same_lat) {
+    ++report.alf_reuses;
+  } else {
+    FillColatitudeSines(h, in, scratch.sn);
+    const double theta = (90.0 - in.geodetic_lat_deg) * kDeg2Rad;
+    AlfBasis(impl, h.maxn, impl.maxo, theta, scratch.gpbar, scratch.gvbar, scratch.gwbar);
+  }
+
+  const int prev_lev = scratch.lev;
+  if (prev != nullptr && prev->altitude_km == in.altitude_km) {
+    ++report.vertical_reuses;
+  } else {
+    VertWght(in.altitude_km, h, scratch.zwght, scratch.lev);
+  }
+  if (prev != nullptr && scratch.lev == prev_lev) {
+    ++report.level_reuses;
+  }
+  scratch.bz.assign(static_cast<std::size_t>(h.nbf), 0.0);
+}
+
+// Evaluates every ensemble member at one input, building the shared basis once per active level and
+// applying it to the level's [members x nbf] coefficient block.
+void QuietWindsEnsembleImpl(const Model::Impl& impl, const Inputs& in, Winds* out) {
+  const auto& h = impl.hwm;
+  auto& scratch = ThreadQuietScratch();
+  PrepareQuietBasis(impl, in, scratch);
+
+  const auto members = static_cast<std::size_t>(impl.ensemble_members);
+  const auto nbf = static_cast<std::size_t>(h.nbf);
+  std::fill_n(out, members, Winds{});
+
+  for (int b = 0; b <= h.p; ++b) {
+    const double wz = scratch.zwght[static_cast<std::size_t>(b)];
+    if (wz == 0.0) {
+      continue;
+    }
+
+    const int d = b + scratch.lev;
+    const int c = FillQuietLevelBasis(impl, d, scratch, scratch).terms;
+    const std::size_t block = nbf * members * static_cast<std::size_t>(d - impl.level_first);
+    for (std::size_t j = 0; j < members; ++j) {
+      const double* mcol = impl.ens_mparm.data() + block + nbf * j;
+      const double* tcol = impl.ens_tparm.data() + block + nbf * j;
+      out[j].zonal_mps += wz * DotN(scratch.bz.data(), mcol, c);
+      out[j].meridional_mps += wz * DotN(scratch.bz.data(), tcol, c);
+    }
+  }
+}
+
+// Emits the weighted basis row of one input: one entry per active term of each level with nonzero
+// vertical weight, in the same column layout as `mparm`/`tparm` (levels relative to `level_first`).
+template <typename Sink>
+void EmitQuietDesignRow(const Model::Impl& impl, const Inputs& in, Sink&& sink) {
+  const auto& h = impl.hwm;
+  auto& scratch = ThreadQuietScratch();
+  PrepareQuietBasis(impl, in, scratch);
+
+  for (int b = 0; b <= h.p; ++b) {
+    const double wz = scratch.zwght[static_cast<std::size_t>(b)];
+    if (wz == 0.0) {
+      continue;
+    }
+    const int d = b + scratch.lev;
+    const int c = FillQuietLevelBasis(impl, d, scratch, scratch).terms;
+    for (int k = 0; k < c; ++k) {
+      sink(d - impl.level_first, k, wz * scratch.bz[static_cast<std::size_t>(k)]);
+    }
+  }
+}
+
+// The nine QD expansion sums at one geodetic point: {x, y, z}, their theta gradients, and their phi
+// gradients. They are smooth over the sphere, so `detail::QdLookupGrid` interpolates these.
+detail::QdSums Gd2qdSums(const detail::DisturbanceTables& dist, double glat_in, double glon) {
   struct Gd2qdScratch {
     std::vector<double> gpbar;
     std::vector<double> gvbar;
@@ -625,43 +870,54 @@ Result<Gd2qdTransform, Error> Gd2qdImpl(const Model::Impl& impl, double glat_in,
   thread_local Gd2qdScratch scratch;
 
   const double theta = (90.0 - glat_in) * kDtor;
-  impl.alf.Basis(impl.gd2qd.nmax, impl.gd2qd.mmax, theta, scratch.gpbar, scratch.gvbar, scratch.gwbar);
+  AlfBasis(dist, dist.gd2qd.nmax, dist.gd2qd.mmax, theta, scratch.gpbar, scratch.gvbar, scratch.gwbar);
 
   const double phi = glon * kDtor;
-  scratch.sh.assign(static_cast<std::size_t>(impl.gd2qd.nterm), 0.0);
-  scratch.shgradtheta.assign(static_cast<std::size_t>(impl.gd2qd.nterm), 0.0);
-  scratch.shgradphi.assign(static_cast<std::size_t>(impl.gd2qd.nterm), 0.0);
+  scratch.sh.assign(static_cast<std::size_t>(dist.gd2qd.nterm), 0.0);
+  scratch.shgradtheta.assign(static_cast<std::size_t>(dist.gd2qd.nterm), 0.0);
+  scratch.shgradphi.assign(static_cast<std::size_t>(dist.gd2qd.nterm), 0.0);
 
   int i = 0;
-  for (int n = 0; n <= impl.gd2qd.nmax; ++n) {
-    scratch.sh[static_cast<std::size_t>(i)] = scratch.gpbar[Idx2(n, 0, impl.gd2qd.mmax)];
+  for (int n = 0; n <= dist.gd2qd.nmax; ++n) {
+    scratch.sh[static_cast<std::size_t>(i)] = scratch.gpbar[Idx2(n, 0, dist.gd2qd.mmax)];
     scratch.shgradtheta[static_cast<std::size_t>(i)] =
-        scratch.gvbar[Idx2(n, 0, impl.gd2qd.mmax)] * impl.normadj[static_cast<std::size_t>(n)];
+        scratch.gvbar[Idx2(n, 0, dist.gd2qd.mmax)] * dist.normadj[static_cast<std::size_t>(n)];
     scratch.shgradphi[static_cast<std::size_t>(i)] = 0.0;
     ++i;
   }
-  for (int m = 1; m <= impl.gd2qd.mmax; ++m) {
+  for (int m = 1; m <= dist.gd2qd.mmax; ++m) {
     const double mphi = static_cast<double>(m) * phi;
     const double cosmphi = std::cos(mphi);
     const double sinmphi = std::sin(mphi);
-    for (int n = m; n <= impl.gd2qd.nmax; ++n) {
-      scratch.sh[static_cast<std::size_t>(i)] = scratch.gpbar[Idx2(n, m, impl.gd2qd.mmax)] * cosmphi;
-      scratch.sh[static_cast<std::size_t>(i + 1)] = scratch.gpbar[Idx2(n, m, impl.gd2qd.mmax)] * sinmphi;
+    for (int n = m; n <= dist.gd2qd.nmax; ++n) {
+      scratch.sh[static_cast<std::size_t>(i)] = scratch.gpbar[Idx2(n, m, dist.gd2qd.mmax)] * cosmphi;
+      scratch.sh[static_cast<std::size_t>(i + 1)] = scratch.gpbar[Idx2(n, m, dist.gd2qd.mmax)] * sinmphi;
       scratch.shgradtheta[static_cast<std::size_t>(i)] =
-          scratch.gvbar[Idx2(n, m, impl.gd2qd.mmax)] * impl.normadj[static_cast<std::size_t>(n)] * cosmphi;
+          scratch.gvbar[Idx2(n, m, dist.gd2qd.mmax)] * dist.normadj[static_cast<std::size_t>(n)] * cosmphi;
       scratch.shgradtheta[static_cast<std::size_t>(i + 1)] =
-          scratch.gvbar[Idx2(n, m, impl.gd2qd.mmax)] * impl.normadj[static_cast<std::size_t>(n)] * sinmphi;
+          scratch.gvbar[Idx2(n, m, dist.gd2qd.mmax)] * dist.normadj[static_cast<std::size_t>(n)] * sinmphi;
       scratch.shgradphi[static_cast<std::size_t>(i)] =
-          -scratch.gwbar[Idx2(n, m, impl.gd2qd.mmax)] * impl.normadj[static_cast<std::size_t>(n)] * sinmphi;
+          -scratch.gwbar[Idx2(n, m, dist.gd2qd.mmax)] * dist.normadj[static_cast<std::size_t>(n)] * sinmphi;
       scratch.shgradphi[static_cast<std::size_t>(i + 1)] =
-          scratch.gwbar[Idx2(n, m, impl.gd2qd.mmax)] * impl.normadj[static_cast<std::size_t>(n)] * cosmphi;
+          scratch.gwbar[Idx2(n, m, dist.gd2qd.mmax)] * dist.normadj[static_cast<std::size_t>(n)] * cosmphi;
       i += 2;
     }
   }
 
-  const double x = std::inner_product(scratch.sh.begin(), scratch.sh.end(), impl.xcoeff.begin(), 0.0);
-  const double y = std::inner_product(scratch.sh.begin(), scratch.sh.end(), impl.ycoeff.begin(), 0.0);
-  const double z = std::inner_product(scratch.sh.begin(), scratch.sh.end(), impl.zcoeff.begin(), 0.0);
+  const auto dot = [](const std::vector<double>& basis, const std::vector<double>& coeff) {
+    return std::inner_product(basis.begin(), basis.end(), coeff.begin(), 0.0);
+  };
+  return {dot(scratch.sh, dist.xcoeff),          dot(scratch.sh, dist.ycoeff),
+          dot(scratch.sh, dist.zcoeff),          dot(scratch.shgradtheta, dist.xcoeff),
+          dot(scratch.shgradtheta, dist.ycoeff), dot(scratch.shgradtheta, dist.zcoeff),
+          dot(scratch.shgradphi, dist.xcoeff),   dot(scratch.shgradphi, dist.ycoeff),
+          dot(scratch.shgradphi, dist.zcoeff)};
+}
+
+Gd2qdTransform Gd2qdFromSums(const detail::QdSums& sums) {
+  const double x = sums[0];
+  const double y = sums[1];
+  const double z = sums[2];
 
   const double qlonrad = std::atan2(y, x);
   const double cosqlon = std::cos(qlonrad);
@@ -671,19 +927,12 @@ Result<Gd2qdTransform, Error> Gd2qdImpl(const Model::Impl& impl, double glat_in,
   const double qlat = std::atan2(z, cosqlat) / kDtor;
   const double qlon = qlonrad / kDtor;
 
-  const double xgradtheta =
-      std::inner_product(scratch.shgradtheta.begin(), scratch.shgradtheta.end(), impl.xcoeff.begin(), 0.0);
-  const double ygradtheta =
-      std::inner_product(scratch.shgradtheta.begin(), scratch.shgradtheta.end(), impl.ycoeff.begin(), 0.0);
-  const double zgradtheta =
-      std::inner_product(scratch.shgradtheta.begin(), scratch.shgradtheta.end(), impl.zcoeff.begin(), 0.0);
-
-  const double xgradphi =
-      std::inner_product(scratch.shgradphi.begin(), scratch.shgradphi.end(), impl.xcoeff.begin(), 0.0);
-  const double ygradphi =
-      std::inner_product(scratch.shgradphi.begin(), scratch.shgradphi.end(), impl.ycoeff.begin(), 0.0);
-  const double zgradphi =
-      std::inner_product(scratch.shgradphi.begin(), scratch.shgradphi.end(), impl.zcoeff.begin(), 0.0);
+  const double xgradtheta = sums[3];
+  const double ygradtheta = sums[4];
+  const double zgradtheta = sums[5];
+  const double xgradphi = sums[6];
+  const double ygradphi = sums[7];
+  const double zgradphi = sums[8];
 
   Gd2qdTransform out{};
   out.qlat = qlat;
@@ -692,11 +941,105 @@ Result<Gd2qdTransform, Error> Gd2qdImpl(const Model::Impl& impl, double glat_in,
   out.f1n = -zgradphi * cosqlat + (xgradphi * cosqlon + ygradphi * sinqlon) * z;
   out.f2e = ygradtheta * cosqlon - xgradtheta * sinqlon;
   out.f2n = ygradphi * cosqlon - xgradphi * sinqlon;
-  return Result<Gd2qdTransform, Error>::Ok(out);
+  return out;
 }
 
-double MltCalcImpl(const Model::Impl& impl, double qlat, double qlon, double day, double ut) {
-  (void)qlat;
+Result<Gd2qdTransform, Error> Gd2qdImpl(const detail::DisturbanceTables& dist, double glat_in, double glon) {
+  return Result<Gd2qdTransform, Error>::Ok(Gd2qdFromSums(Gd2qdSums(dist, glat_in, glon)));
+}
+
+std::shared_ptr<const detail::QdLookupGrid> BuildQdLookupGrid(const detail::DisturbanceTables& dist,
+                                                              double step_deg) {
+  auto grid = std::make_shared<detail::QdLookupGrid>();
+  grid->step_deg = step_deg;
+  grid->nlat = static_cast<int>(std::lround(180.0 / step_deg)) + 1;
+  grid->nlon = 2 * (grid->nlat - 1);
+  grid->nodes.resize(static_cast<std::size_t>(grid->nlat) * static_cast<std::size_t>(grid->nlon));
+  for (int i = 0; i < grid->nlat; ++i) {
+    const double glat = std::min(-90.0 + step_deg * i, 90.0);
+    for (int j = 0; j < grid->nlon; ++j) {
+      grid->nodes[static_cast<std::size_t>(i * grid->nlon + j)] = Gd2qdSums(dist, glat, -180.0 + step_deg * j);
+    }
+  }
+  return grid;
+}
+
+detail::QdSums InterpolateQdSums(const detail::QdLookupGrid& g, double glat, double glon) {
+  const double u = (glat + 90.0) / g.step_deg;
+  const int i = std::clamp(static_cast<int>(std::floor(u)), 0, g.nlat - 2);
+  double v = std::fmod((glon + 180.0) / g.step_deg, static_cast<double>(g.nlon));
+  if (v < 0.0) {
+    v += static_cast<double>(g.nlon);
+  }
+  const int j = std::min(static_cast<int>(std::floor(v)), g.nlon - 1);
+  const auto wu = detail::CubicWeights(u - i);
+  const auto wv = detail::CubicWeights(v - j);
+
+  detail::QdSums out{};
+  for (int a = 0; a < 4; ++a) {
+    // Rows past a pole continue over it: same colatitude distance, opposite meridian, and the theta/phi
+    // unit vectors reversed.
+    int row = i - 1 + a;
+    int shift = 0;
+    double grad_sign = 1.0;
+    if (row < 0 || row > g.nlat - 1) {
+      row = row < 0 ? -row : 2 * (g.nlat - 1) - row;
+      shift = g.nlon / 2;
+      grad_sign = -1.0;
+    }
+    for (int b = 0; b < 4; ++b) {
+      const int col = (j - 1 + b + shift + g.nlon) % g.nlon;
+      const auto& node = g.nodes[static_cast<std::size_t>(row * g.nlon + col)];
+      const double w = wu[static_cast<std::size_t>(a)] * wv[static_cast<std::size_t>(b)];
+      for (std::size_t k = 0; k < 3; ++k) {
+        out[k] += w * node[k];
+      }
+      for (std::size_t k = 3; k < out.size(); ++k) {
+        out[k] += grad_sign * w * node[k];
+      }
+    }
+  }
+  return out;
+}
+
+// The lookup grid of `impl` (built on first use against `dist`), or null when the model uses the exact
+// transform.
+const detail::QdLookupGrid* ResolveQdGrid(const Model::Impl& impl, const detail::DisturbanceTables& dist) {
+  if (!impl.qd_grid) {
+    return nullptr;
+  }
+  auto& lazy = *impl.qd_grid;
+  std::call_once(lazy.once, [&lazy, &dist] { lazy.grid = BuildQdLookupGrid(dist, lazy.step_deg); });
+  return lazy.grid.get();
+}
+
+// Interpolated transform, or the exact one within about 1 degree of a QD pole: there qlon and the f1/f2
+// frame turn with atan2(y, x) of two vanishing sums, so small interpolation errors are amplified.
+Gd2qdTransform Gd2qdFromGrid(const detail::QdLookupGrid& grid,
+                             const detail::DisturbanceTables& dist,
+                             double glat,
+                             double glon) {
+  constexpr double kPoleCosQlat = 0.0175;
+  const auto sums = InterpolateQdSums(grid, glat, glon);
+  if (std::hypot(sums[0], sums[1]) < kPoleCosQlat) {
+    return Gd2qdFromSums(Gd2qdSums(dist, glat, glon));
+  }
+  return Gd2qdFromSums(sums);
+}
+
+// `Gd2qdImpl`, served from the model's lookup grid when `Options::qd_grid_step_deg` is set.
+Result<Gd2qdTransform, Error> Gd2qdFor(const Model::Impl& impl,
+                                       const detail::DisturbanceTables& dist,
+                                       double glat,
+                                       double glon) {
+  if (const auto* grid = ResolveQdGrid(impl, dist)) {
+    return Result<Gd2qdTransform, Error>::Ok(Gd2qdFromGrid(*grid, dist, glat, glon));
+  }
+  return Gd2qdImpl(dist, glat, glon);
+}
+
+// QD longitude of the subsolar point; depends only on (day, ut), so batch transforms reuse it.
+double SubsolarQdLon(const detail::DisturbanceTables& dist, double day, double ut) {
   const double asunglat = -std::asin(std::sin((day + ut / 24.0 - 80.0) * kDtor) * kSineps) / kDtor;
   const double asunglon = -ut * 15.0;
 
@@ -709,204 +1052,639 @@ double MltCalcImpl(const Model::Impl& impl, double qlat, double qlon, double day
   thread_local MltScratch scratch;
 
   const double theta = (90.0 - asunglat) * kDtor;
-  impl.alf.Basis(impl.gd2qd.nmax, impl.gd2qd.mmax, theta, scratch.spbar, scratch.svbar, scratch.swbar);
+  AlfBasis(dist, dist.gd2qd.nmax, dist.gd2qd.mmax, theta, scratch.spbar, scratch.svbar, scratch.swbar);
 
   const double phi = asunglon * kDtor;
-  scratch.sh.assign(static_cast<std::size_t>(impl.gd2qd.nterm), 0.0);
+  scratch.sh.assign(static_cast<std::size_t>(dist.gd2qd.nterm), 0.0);
   int i = 0;
-  for (int n = 0; n <= impl.gd2qd.nmax; ++n) {
-    scratch.sh[static_cast<std::size_t>(i)] = scratch.spbar[Idx2(n, 0, impl.gd2qd.mmax)];
+  for (int n = 0; n <= dist.gd2qd.nmax; ++n) {
+    scratch.sh[static_cast<std::size_t>(i)] = scratch.spbar[Idx2(n, 0, dist.gd2qd.mmax)];
     ++i;
   }
-  for (int m = 1; m <= impl.gd2qd.mmax; ++m) {
+  for (int m = 1; m <= dist.gd2qd.mmax; ++m) {
     const double mphi = static_cast<double>(m) * phi;
     const double cosmphi = std::cos(mphi);
     const double sinmphi = std::sin(mphi);
-    for (int n = m; n <= impl.gd2qd.nmax; ++n) {
-      scratch.sh[static_cast<std::size_t>(i)] = scratch.spbar[Idx2(n, m, impl.gd2qd.mmax)] * cosmphi;
-      scratch.sh[static_cast<std::size_t>(i + 1)] = scratch.spbar[Idx2(n, m, impl.gd2qd.mmax)] * sinmphi;
+    for (int n = m; n <= dist.gd2qd.nmax; ++n) {
+      scratch.sh[static_cast<std::size_t>(i)] = scratch.spbar[Idx2(n, m, dist.gd2qd.mmax)] * cosmphi;
+      scratch.sh[static_cast<std::size_t>(i + 1)] = scratch.spbar[Idx2(n, m, dist.gd2qd.mmax)] * sinmphi;
       i += 2;
     }
   }
 
-  const double x = std::inner_product(scratch.sh.begin(), scratch.sh.end(), impl.xcoeff.begin(), 0.0);
-  const double y = std::inner_product(scratch.sh.begin(), scratch.sh.end(), impl.ycoeff.begin(), 0.0);
-  const double asunqlon = std::atan2(y, x) / kDtor;
+  const double x = std::inner_product(scratch.sh.begin(), scratch.sh.end(), dist.xcoeff.begin(), 0.0);
+  const double y = std::inner_product(scratch.sh.begin(), scratch.sh.end(), dist.ycoeff.begin(), 0.0);
+  return std::atan2(y, x) / kDtor;
+}
 
-  return (qlon - asunqlon) / 15.0;
+double MltCalcImpl(const detail::DisturbanceTables& dist, double qlat, double qlon, double day, double ut) {
+  (void)qlat;
+  return (qlon - SubsolarQdLon(dist, day, ut)) / 15.0;
 }
 
-Result<Winds, Error> DisturbanceWindsMagImpl(const Model::Impl& impl, double mlt_h, double mlat_deg, double kp) {
-  struct DwmScratch {
-    std::vector<double> dpbar;
-    std::vector<double> dvbar;
-    std::vector<double> dwbar;
-    std::vector<std::array<double, 2>> mltterms;
-    std::vector<std::array<double, 2>> vshterms;
-  };
-  thread_local DwmScratch scratch;
+// DWM coefficients folded for one Kp: with the Kp spline weights fixed, every term reduces to a
+// coefficient on one VSH row, with or without the latitude weight.
+struct KpFold {
+  std::uint64_t tables_id{};
+  double kp{};
+  std::vector<double> plain;     // per VSH row (including the pad row), terms without the latitude weight
+  std::vector<double> weighted;  // per VSH row, terms multiplied by the latitude weight
+};
 
-  const double theta = (90.0 - mlat_deg) * kDtor;
-  impl.alf.Basis(impl.dwm.nmax, impl.dwm.mmax, theta, scratch.dpbar, scratch.dvbar, scratch.dwbar);
+// Folds the DWM coefficients of `dist` for `kp` (with spline weights `kpterms`) into `f`.
+void FoldKp(const detail::DisturbanceTables& dist, double kp, const std::array<double, 4>& kpterms, KpFold& f) {
+  const auto rows = static_cast<std::size_t>(dist.nvshterm) + 1U;
+  f.plain.assign(rows, 0.0);
+  f.weighted.assign(rows, 0.0);
+  const auto& prog = dist.dwm_terms;
+  for (std::size_t i = 0; i < prog.coeff.size(); ++i) {
+    auto& dst = prog.lat[i] != 0 ? f.weighted : f.plain;
+    dst[static_cast<std::size_t>(prog.vsh[i])] += prog.coeff[i] * kpterms[prog.kp[i]];
+  }
+  f.tables_id = dist.id;
+  f.kp = kp;
+}
+
+// Per-thread folds of the most recently used Kp values (`Options::enable_cache`). Operational ap3
+// changes every few hours, so a handful of entries covers point evaluation without locking.
+const KpFold& KpFoldFor(const detail::DisturbanceTables& dist, double kp, const std::array<double, 4>& kpterms) {
+  constexpr std::size_t kEntries = 4;
+  thread_local std::array<KpFold, kEntries> folds;
+  thread_local std::size_t next = 0;
+  for (const auto& f : folds) {
+    if (f.tables_id == dist.id && f.kp == kp) {
+      return f;
+    }
+  }
 
-  scratch.mltterms.assign(static_cast<std::size_t>(impl.dwm.mmax + 1), {0.0, 0.0});
+  auto& f = folds[next];
+  next = (next + 1) % kEntries;
+  FoldKp(dist, kp, kpterms, f);
+  return f;
+}
+
+// Per-thread DWM buffers; `dvbar`/`dwbar` depend only on mlat and `mltterms` only on MLT, so the grid
+// path keeps one row of basis and a table of harmonics per column.
+struct DwmScratch {
+  std::vector<double> dpbar;
+  std::vector<double> dvbar;
+  std::vector<double> dwbar;
+  std::vector<std::array<double, 2>> mltterms;
+  std::vector<std::array<double, 2>> vshterms;
+  std::vector<KpFold> folds;  // one per Kp of a grid request
+};
+
+DwmScratch& ThreadDwmScratch() {
+  thread_local DwmScratch scratch;
+  return scratch;
+}
+
+// Writes the `mmax + 1` MLT harmonics {cos(m phi), sin(m phi)} to `out`.
+void FillDwmMltTerms(const detail::DisturbanceTables& dist, double mlt_h, std::array<double, 2>* out) {
   const double phi = mlt_h * kDtor * 15.0;
-  for (int m = 0; m <= impl.dwm.mmax; ++m) {
+  for (int m = 0; m <= dist.dwm.mmax; ++m) {
     const double mphi = static_cast<double>(m) * phi;
-    scratch.mltterms[static_cast<std::size_t>(m)][0] = std::cos(mphi);
-    scratch.mltterms[static_cast<std::size_t>(m)][1] = std::sin(mphi);
+    out[m][0] = std::cos(mphi);
+    out[m][1] = std::sin(mphi);
   }
+}
 
-  scratch.vshterms.assign(static_cast<std::size_t>(impl.nvshterm), {0.0, 0.0});
+// Writes the `nvshterm + 1` VSH rows of one (mlat, MLT) cell; the extra {1, 1} row is the pad target
+// of terms without a VSH factor (see `DwmTermProgram`).
+void FillDwmVshTerms(const detail::DisturbanceTables& dist,
+                     const std::vector<double>& dvbar,
+                     const std::vector<double>& dwbar,
+                     const std::array<double, 2>* mltterms,
+                     std::array<double, 2>* vsh) {
+  const int mmax = dist.dwm.mmax;
   int ivshterm = 0;
-  for (int n = 1; n <= impl.dwm.nmax; ++n) {
-    scratch.vshterms[static_cast<std::size_t>(ivshterm)][0] =
-        -scratch.dvbar[Idx2(n, 0, impl.dwm.mmax)] * scratch.mltterms[0][0];
-    scratch.vshterms[static_cast<std::size_t>(ivshterm + 1)][0] =
-        scratch.dwbar[Idx2(n, 0, impl.dwm.mmax)] * scratch.mltterms[0][0];
-    scratch.vshterms[static_cast<std::size_t>(ivshterm)][1] =
-        -scratch.vshterms[static_cast<std::size_t>(ivshterm + 1)][0];
-    scratch.vshterms[static_cast<std::size_t>(ivshterm + 1)][1] =
-        scratch.vshterms[static_cast<std::size_t>(ivshterm)][0];
+  for (int n = 1; n <= dist.dwm.nmax; ++n) {
+    vsh[ivshterm][0] = -dvbar[Idx2(n, 0, mmax)] * mltterms[0][0];
+    vsh[ivshterm + 1][0] = dwbar[Idx2(n, 0, mmax)] * mltterms[0][0];
+    vsh[ivshterm][1] = -vsh[ivshterm + 1][0];
+    vsh[ivshterm + 1][1] = vsh[ivshterm][0];
     ivshterm += 2;
 
-    for (int m = 1; m <= impl.dwm.mmax; ++m) {
+    for (int m = 1; m <= mmax; ++m) {
       if (m > n) {
         continue;
       }
-      scratch.vshterms[static_cast<std::size_t>(ivshterm)][0] =
-          -scratch.dvbar[Idx2(n, m, impl.dwm.mmax)] * scratch.mltterms[static_cast<std::size_t>(m)][0];
-      scratch.vshterms[static_cast<std::size_t>(ivshterm + 1)][0] =
-          scratch.dvbar[Idx2(n, m, impl.dwm.mmax)] * scratch.mltterms[static_cast<std::size_t>(m)][1];
-      scratch.vshterms[static_cast<std::size_t>(ivshterm + 2)][0] =
-          scratch.dwbar[Idx2(n, m, impl.dwm.mmax)] * scratch.mltterms[static_cast<std::size_t>(m)][1];
-      scratch.vshterms[static_cast<std::size_t>(ivshterm + 3)][0] =
-          scratch.dwbar[Idx2(n, m, impl.dwm.mmax)] * scratch.mltterms[static_cast<std::size_t>(m)][0];
-      scratch.vshterms[static_cast<std::size_t>(ivshterm)][1] =
-          -scratch.vshterms[static_cast<std::size_t>(ivshterm + 2)][0];
-      scratch.vshterms[static_cast<std::size_t>(ivshterm + 1)][1] =
-          -scratch.vshterms[static_cast<std::size_t>(ivshterm + 3)][0];
-      scratch.vshterms[static_cast<std::size_t>(ivshterm + 2)][1] =
-          scratch.vshterms[static_cast<std::size_t>(ivshterm)][0];
-      scratch.vshterms[static_cast<std::size_t>(ivshterm + 3)][1] =
-          scratch.vshterms[static_cast<std::size_t>(ivshterm + 1)][0];
+      vsh[ivshterm][0] = -dvbar[Idx2(n, m, mmax)] * mltterms[m][0];
+      vsh[ivshterm + 1][0] = dvbar[Idx2(n, m, mmax)] * mltterms[m][1];
+      vsh[ivshterm + 2][0] = dwbar[Idx2(n, m, mmax)] * mltterms[m][1];
+      vsh[ivshterm + 3][0] = dwbar[Idx2(n, m, mmax)] * mltterms[m][0];
+      vsh[ivshterm][1] = -vsh[ivshterm + 2][0];
+      vsh[ivshterm + 1][1] = -vsh[ivshterm + 3][0];
+      vsh[ivshterm + 2][1] = vsh[ivshterm][0];
+      vsh[ivshterm + 3][1] = vsh[ivshterm + 1][0];
       ivshterm += 4;
     }
   }
+  vsh[dist.nvshterm] = {1.0, 1.0};
+}
 
-  std::array<double, 3> kpterms{};
-  KpSpl3(kp, kpterms);
-  const double latwgtterm = LatWgt2(mlat_deg, mlt_h, kp, impl.dwm.twidth);
+std::array<double, 4> DwmKpTerms(double kp) {
+  std::array<double, 3> kpspl{};
+  KpSpl3(kp, kpspl);
+  return {kpspl[0], kpspl[1], kpspl[2], 1.0};
+}
 
+// Same products and accumulation order as multiplying in each present factor after `1.0`.
+Winds DwmTermSum(const detail::DisturbanceTables& dist,
+                 const std::array<double, 2>* vshterms,
+                 const std::array<double, 4>& kpterms,
+                 double latwgt) {
+  const auto& prog = dist.dwm_terms;
+  const std::array<double, 2> latterms = {1.0, latwgt};
   double mmpwind = 0.0;
   double mzpwind = 0.0;
-  for (int iterm = 0; iterm < impl.dwm.nterm; ++iterm) {
-    double term0 = 1.0;
-    double term1 = 1.0;
+  for (std::size_t iterm = 0; iterm < prog.coeff.size(); ++iterm) {
+    const auto& vsh = vshterms[prog.vsh[iterm]];
+    const double k = kpterms[prog.kp[iterm]];
+    const double l = latterms[prog.lat[iterm]];
+    const double term0 = vsh[0] * k * l;
+    const double term1 = vsh[1] * k * l;
+    mmpwind += prog.coeff[iterm] * term0;
+    mzpwind += prog.coeff[iterm] * term1;
+  }
 
-    const int t0 = impl.dwm.termarr_flat[static_cast<std::size_t>(3 * iterm)];
-    const int t1 = impl.dwm.termarr_flat[static_cast<std::size_t>(3 * iterm + 1)];
-    const int t2 = impl.dwm.termarr_flat[static_cast<std::size_t>(3 * iterm + 2)];
+  Winds out{};
+  out.meridional_mps = mmpwind;
+  out.zonal_mps = mzpwind;
+  return out;
+}
 
-    if (t0 != 999) {
-      term0 *= scratch.vshterms[static_cast<std::size_t>(t0)][0];
-      term1 *= scratch.vshterms[static_cast<std::size_t>(t0)][1];
-    }
-    if (t1 != 999) {
-      term0 *= kpterms[static_cast<std::size_t>(t1)];
-      term1 *= kpterms[static_cast<std::size_t>(t1)];
+Winds DwmFoldedSum(const KpFold& fold, const std::array<double, 2>* vshterms, double latwgt) {
+  double mm0 = 0.0;
+  double mz0 = 0.0;
+  double mm1 = 0.0;
+  double mz1 = 0.0;
+  for (std::size_t r = 0; r < fold.plain.size(); ++r) {
+    mm0 += fold.plain[r] * vshterms[r][0];
+    mz0 += fold.plain[r] * vshterms[r][1];
+    mm1 += fold.weighted[r] * vshterms[r][0];
+    mz1 += fold.weighted[r] * vshterms[r][1];
+  }
+  Winds out{};
+  out.meridional_mps = mm0 + latwgt * mm1;
+  out.zonal_mps = mz0 + latwgt * mz1;
+  return out;
+}
+
+// `mltterms`, when given, supplies the `mmax + 1` MLT harmonics of `mlt_h` instead of computing them.
+Result<Winds, Error> DisturbanceWindsMagImpl(const detail::DisturbanceTables& dist,
+                                             double mlt_h,
+                                             double mlat_deg,
+                                             double kp,
+                                             bool fold_kp,
+                                             const std::array<double, 2>* mltterms = nullptr) {
+  auto& scratch = ThreadDwmScratch();
+  const double theta = (90.0 - mlat_deg) * kDtor;
+  AlfBasis(dist, dist.dwm.nmax, dist.dwm.mmax, theta, scratch.dpbar, scratch.dvbar, scratch.dwbar);
+
+  if (mltterms == nullptr) {
+    scratch.mltterms.resize(static_cast<std::size_t>(dist.dwm.mmax + 1));
+    FillDwmMltTerms(dist, mlt_h, scratch.mltterms.data());
+    mltterms = scratch.mltterms.data();
+  }
+  scratch.vshterms.resize(static_cast<std::size_t>(dist.nvshterm) + 1U);
+  FillDwmVshTerms(dist, scratch.dvbar, scratch.dwbar, mltterms, scratch.vshterms.data());
+
+  const auto kpterms = DwmKpTerms(kp);
+  const double latwgt = LatWgt2(mlat_deg, mlt_h, kp, dist.dwm.twidth);
+  if (fold_kp) {
+    return Result<Winds, Error>::Ok(DwmFoldedSum(KpFoldFor(dist, kp, kpterms), scratch.vshterms.data(), latwgt));
+  }
+  return Result<Winds, Error>::Ok(DwmTermSum(dist, scratch.vshterms.data(), kpterms, latwgt));
+}
+
+QdCoordinates ToQdCoordinates(const Gd2qdTransform& tr, double mlt_h) {
+  QdCoordinates qd{};
+  qd.qlat_deg = tr.qlat;
+  qd.qlon_deg = tr.qlon;
+  qd.mlt_h = mlt_h;
+  qd.f1_east = tr.f1e;
+  qd.f1_north = tr.f1n;
+  qd.f2_east = tr.f2e;
+  qd.f2_north = tr.f2n;
+  return qd;
+}
+
+// Disturbance winds of `in` from its QD transform: magnetic winds rotated onto the f1/f2 base vectors
+// and damped below 125 km. `in` is validated and has `ap3 >= 0`; `mltterms` as in `DisturbanceWindsMagImpl`.
+Winds DisturbanceWindsFromQd(const detail::DisturbanceTables& dist,
+                             const Inputs& in,
+                             const QdCoordinates& qd,
+                             bool fold_kp,
+                             const std::array<double, 2>* mltterms = nullptr) {
+  const double kp = Ap2Kp(in.ap3);
+  const Winds mag = DisturbanceWindsMagImpl(dist, qd.mlt_h, qd.qlat_deg, kp, fold_kp, mltterms).value();
+
+  Winds dw{};
+  dw.meridional_mps = qd.f2_north * mag.meridional_mps + qd.f1_north * mag.zonal_mps;
+  dw.zonal_mps = qd.f2_east * mag.meridional_mps + qd.f1_east * mag.zonal_mps;
+
+  const double height_scale = 1.0 + std::exp(-(in.altitude_km - 125.0) / dist.dwm.twidth);
+  dw.meridional_mps /= height_scale;
+  dw.zonal_mps /= height_scale;
+  return dw;
+}
+
+// Grid form of `DisturbanceWindsMagImpl`: the ALF basis is built once per mlat row and the MLT
+// harmonics once per column, then every Kp slab of the row is summed from the same VSH rows. Each cell
+// performs the point path's arithmetic, so results are bit-identical to point calls.
+void DisturbanceWindsMagGridImpl(const detail::DisturbanceTables& dist,
+                                 std::span<const double> mlat_deg,
+                                 std::span<const double> mlt_h,
+                                 std::span<const double> kp,
+                                 std::size_t kp_stride,
+                                 bool fold_kp,
+                                 Winds* out) {
+  auto& scratch = ThreadDwmScratch();
+  const auto cols = mlt_h.size();
+  const auto nharm = static_cast<std::size_t>(dist.dwm.mmax + 1);
+  const auto nrows = static_cast<std::size_t>(dist.nvshterm) + 1U;
+
+  scratch.mltterms.resize(cols * nharm);
+  for (std::size_t j = 0; j < cols; ++j) {
+    FillDwmMltTerms(dist, mlt_h[j], scratch.mltterms.data() + j * nharm);
+  }
+  scratch.vshterms.resize(cols * nrows);
+  // Every Kp is folded once per request, outside the row loop, so requests with more Kp values than
+  // `KpFoldFor` keeps do not refold on every row.
+  if (fold_kp) {
+    scratch.folds.resize(std::max(scratch.folds.size(), kp.size()));
+    for (std::size_t k = 0; k < kp.size(); ++k) {
+      auto& f = scratch.folds[k];
+      if (f.tables_id != dist.id || f.kp != kp[k]) {
+        FoldKp(dist, kp[k], DwmKpTerms(kp[k]), f);
+      }
     }
-    if (t2 != 999) {
-      term0 *= latwgtterm;
-      term1 *= latwgtterm;
+  }
+
+  for (std::size_t i = 0; i < mlat_deg.size(); ++i) {
+    const double theta = (90.0 - mlat_deg[i]) * kDtor;
+    AlfBasis(dist, dist.dwm.nmax, dist.dwm.mmax, theta, scratch.dpbar, scratch.dvbar, scratch.dwbar);
+    for (std::size_t j = 0; j < cols; ++j) {
+      FillDwmVshTerms(dist, scratch.dvbar, scratch.dwbar, scratch.mltterms.data() + j * nharm,
+                      scratch.vshterms.data() + j * nrows);
     }
 
-    const double c = impl.dwm.coeff[static_cast<std::size_t>(iterm)];
-    mmpwind += c * term0;
-    mzpwind += c * term1;
+    for (std::size_t k = 0; k < kp.size(); ++k) {
+      const auto kpterms = DwmKpTerms(kp[k]);
+      const KpFold* fold = fold_kp ? &scratch.folds[k] : nullptr;
+      Winds* row = out + k * kp_stride + i * cols;
+      for (std::size_t j = 0; j < cols; ++j) {
+        const auto* vsh = scratch.vshterms.data() + j * nrows;
+        const double latwgt = LatWgt2(mlat_deg[i], mlt_h[j], kp[k], dist.dwm.twidth);
+        row[j] = fold != nullptr ? DwmFoldedSum(*fold, vsh, latwgt) : DwmTermSum(dist, vsh, kpterms, latwgt);
+      }
+    }
   }
-
-  Winds out{};
-  out.meridional_mps = mmpwind;
-  out.zonal_mps = mzpwind;
-  return Result<Winds, Error>::Ok(out);
 }
 
 }  // namespace
 
-Result<Model, Error> Model::LoadFromResolvedPaths(DataPaths paths, Options options) {
-  auto hwm = detail::LoadHwmBinHeader(paths.hwm_bin);
-  if (!hwm) {
-    return Result<Model, Error>::Err(hwm.error());
+namespace {
+
+// Thread budget for derived-table construction: 1 (serial) unless `Options::parallel_load` is set.
+int LoadWorkers(const Options& options) {
+  if (!options.parallel_load) {
+    return 1;
   }
+  return static_cast<int>(std::clamp(std::thread::hardware_concurrency(), 1U, 8U));
+}
 
-  auto gd2qd = detail::LoadGd2qdData(paths.gd2qd_dat);
-  if (!gd2qd) {
-    return Result<Model, Error>::Err(gd2qd.error());
+// Derives the QD/DWM tables. The shared ALF state covers the quiet dimensions too, matching the layout
+// stored in blobs.
+std::shared_ptr<detail::DisturbanceTables> BuildDisturbanceTables(int quiet_maxn,
+                                                                  int quiet_maxo,
+                                                                  detail::Gd2qdData gd2qd,
+                                                                  detail::DwmData dwm) {
+  auto dist = std::make_shared<detail::DisturbanceTables>();
+  dist->gd2qd = std::move(gd2qd);
+  dist->dwm = std::move(dwm);
+
+  dist->nmaxgeo = std::max(quiet_maxn, dist->gd2qd.nmax);
+  dist->mmaxgeo = std::max(quiet_maxo, dist->gd2qd.mmax);
+
+  const int nmax0 = std::max(dist->nmaxgeo, dist->dwm.nmax);
+  const int mmax0 = std::max(dist->mmaxgeo, dist->dwm.mmax);
+  dist->alf.Init(nmax0, mmax0);
+  detail::BindFixedAlfKernels(*dist);
+
+  dist->xcoeff.assign(static_cast<std::size_t>(dist->gd2qd.nterm), 0.0);
+  dist->ycoeff.assign(static_cast<std::size_t>(dist->gd2qd.nterm), 0.0);
+  dist->zcoeff.assign(static_cast<std::size_t>(dist->gd2qd.nterm), 0.0);
+  for (int iterm = 0; iterm < dist->gd2qd.nterm; ++iterm) {
+    dist->xcoeff[static_cast<std::size_t>(iterm)] =
+        dist->gd2qd.coeff_flat[static_cast<std::size_t>(iterm) + static_cast<std::size_t>(dist->gd2qd.nterm) * 0U];
+    dist->ycoeff[static_cast<std::size_t>(iterm)] =
+        dist->gd2qd.coeff_flat[static_cast<std::size_t>(iterm) + static_cast<std::size_t>(dist->gd2qd.nterm) * 1U];
+    dist->zcoeff[static_cast<std::size_t>(iterm)] =
+        dist->gd2qd.coeff_flat[static_cast<std::size_t>(iterm) + static_cast<std::size_t>(dist->gd2qd.nterm) * 2U];
   }
 
-  auto dwm = detail::LoadDwmData(paths.dwm_dat);
-  if (!dwm) {
-    return Result<Model, Error>::Err(dwm.error());
+  dist->normadj.assign(static_cast<std::size_t>(dist->gd2qd.nmax + 1), 0.0);
+  for (int n = 0; n <= dist->gd2qd.nmax; ++n) {
+    dist->normadj[static_cast<std::size_t>(n)] = std::sqrt(static_cast<double>(n * (n + 1)));
   }
 
+  dist->nvshterm = detail::DwmVshTermCount(dist->dwm.nmax, dist->dwm.mmax);
+  // `ParseDwmData` already rejected out-of-range term indices.
+  [[maybe_unused]] const bool compiled = detail::CompileDwmTermProgram(*dist);
+  assert(compiled);
+  return dist;
+}
+
+// Parsed QD and DWM files handed to `BuildImpl` for eager loads.
+struct DisturbanceSources {
+  detail::Gd2qdData gd2qd;
+  detail::DwmData dwm;
+};
+
+// Derives every table the evaluators need; the disturbance side only when `sources` is given. With
+// `workers > 1` the quiet parity columns are derived concurrently with the ALF/QD tables.
+std::shared_ptr<Model::Impl> BuildImpl(DataPaths paths,
+                                       detail::HwmBinHeader hwm,
+                                       std::optional<DisturbanceSources> sources,
+                                       int workers = 1,
+                                       std::optional<AltitudeBand> band = {}) {
   auto impl = std::make_shared<Model::Impl>();
   impl->paths = std::move(paths);
-  impl->hwm = std::move(hwm.value());
-  impl->gd2qd = std::move(gd2qd.value());
-  impl->dwm = std::move(dwm.value());
+  impl->hwm = std::move(hwm);
+
+  auto coeffs = std::make_shared<detail::QuietCoefficientStorage>();
+  coeffs->mparm = std::move(impl->hwm.mparm);
+  impl->hwm.mparm = {};
+  if (band) {
+    const auto [first, last] = BandLevels(impl->hwm, *band);
+    const auto nbf = static_cast<std::size_t>(impl->hwm.nbf);
+    coeffs->mparm.erase(coeffs->mparm.begin() + static_cast<std::ptrdiff_t>(nbf * static_cast<std::size_t>(last + 1)),
+                        coeffs->mparm.end());
+    coeffs->mparm.erase(coeffs->mparm.begin(),
+                        coeffs->mparm.begin() + static_cast<std::ptrdiff_t>(nbf * static_cast<std::size_t>(first)));
+    coeffs->mparm.shrink_to_fit();
+    impl->level_first = first;
+    impl->altitude_band = band;
+  }
+  const auto derive_quiet = [&impl, &coeffs, workers] {
+    DeriveParityColumns(impl->hwm, coeffs->mparm, coeffs->tparm, std::max(workers - 1, 1), impl->level_first);
+  };
+  std::future<void> quiet_task;
+  if (workers > 1) {
+    quiet_task = std::async(std::launch::async | std::launch::deferred, derive_quiet);
+  } else {
+    derive_quiet();
+  }
 
   impl->maxo = std::max({impl->hwm.maxs, impl->hwm.maxm, impl->hwm.maxl});
-  impl->nmaxgeo = std::max(impl->hwm.maxn, impl->gd2qd.nmax);
-  impl->mmaxgeo = std::max(impl->maxo, impl->gd2qd.mmax);
+  impl->alf.Init(impl->hwm.maxn, impl->maxo);
+  detail::BindFixedAlfKernels(*impl);
+  if (sources) {
+    impl->disturbance =
+        BuildDisturbanceTables(impl->hwm.maxn, impl->maxo, std::move(sources->gd2qd), std::move(sources->dwm));
+  }
+
+  if (quiet_task.valid()) {
+    quiet_task.get();
+  }
+  impl->mparm = coeffs->mparm;
+  impl->tparm = coeffs->tparm;
+  impl->coeff_storage = std::move(coeffs);
+  detail::BindQuietLevelKernels(*impl);
+  return impl;
+}
+
+}  // namespace
+
+namespace detail {
+
+Result<std::shared_ptr<const DisturbanceTables>, Error> ResolveDisturbance(const Model::Impl& impl,
+                                                                           std::string_view where) {
+  using R = Result<std::shared_ptr<const DisturbanceTables>, Error>;
+  if (impl.disturbance) {
+    return R::Ok(impl.disturbance);
+  }
+  if (!impl.lazy_disturbance) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput, "disturbance model not loaded (Options::quiet_only)", {},
+                            std::string(where)));
+  }
 
-  const int nmax0 = std::max(impl->nmaxgeo, impl->dwm.nmax);
-  const int mmax0 = std::max(impl->mmaxgeo, impl->dwm.mmax);
-  impl->alf.Init(nmax0, mmax0);
+  auto& lazy = *impl.lazy_disturbance;
+  std::call_once(lazy.once, [&lazy, where] {
+    if (lazy.interned_files) {
+      auto files = IdentifyDataFiles(lazy.paths);
+      if (!files) {
+        lazy.error = files.error();
+        return;
+      }
+      if (files.value().dwm_dat != lazy.interned_files->dwm_dat ||
+          files.value().gd2qd_dat != lazy.interned_files->gd2qd_dat) {
+        lazy.error = MakeError(ErrorCode::kDataFileOpenFailed, "disturbance data changed since the model was interned",
+                               lazy.paths.dwm_dat.parent_path().string(), std::string(where));
+        return;
+      }
+    }
+    auto gd2qd = LoadGd2qdData(lazy.paths.gd2qd_dat);
+    if (!gd2qd) {
+      lazy.error = gd2qd.error();
+      return;
+    }
+    auto dwm = LoadDwmData(lazy.paths.dwm_dat);
+    if (!dwm) {
+      lazy.error = dwm.error();
+      return;
+    }
+    lazy.tables =
+        BuildDisturbanceTables(lazy.quiet_maxn, lazy.quiet_maxo, std::move(gd2qd.value()), std::move(dwm.value()));
+  });
+  if (!lazy.tables) {
+    return R::Err(*lazy.error);
+  }
+  return R::Ok(lazy.tables);
+}
 
-  impl->xcoeff.assign(static_cast<std::size_t>(impl->gd2qd.nterm), 0.0);
-  impl->ycoeff.assign(static_cast<std::size_t>(impl->gd2qd.nterm), 0.0);
-  impl->zcoeff.assign(static_cast<std::size_t>(impl->gd2qd.nterm), 0.0);
-  for (int iterm = 0; iterm < impl->gd2qd.nterm; ++iterm) {
-    impl->xcoeff[static_cast<std::size_t>(iterm)] =
-        impl->gd2qd.coeff_flat[static_cast<std::size_t>(iterm) + static_cast<std::size_t>(impl->gd2qd.nterm) * 0U];
-    impl->ycoeff[static_cast<std::size_t>(iterm)] =
-        impl->gd2qd.coeff_flat[static_cast<std::size_t>(iterm) + static_cast<std::size_t>(impl->gd2qd.nterm) * 1U];
-    impl->zcoeff[static_cast<std::size_t>(iterm)] =
-        impl->gd2qd.coeff_flat[static_cast<std::size_t>(iterm) + static_cast<std::size_t>(impl->gd2qd.nterm) * 2U];
+bool CompileDwmTermProgram(DisturbanceTables& tables) {
+  if (!DwmTermIndicesValid(tables.dwm) || tables.nvshterm != DwmVshTermCount(tables.dwm.nmax, tables.dwm.mmax)) {
+    return false;
   }
+  auto& prog = tables.dwm_terms;
+  const auto nterm = static_cast<std::size_t>(tables.dwm.nterm);
+  prog.vsh.resize(nterm);
+  prog.kp.resize(nterm);
+  prog.lat.resize(nterm);
+  prog.coeff.resize(nterm);
+  for (std::size_t i = 0; i < nterm; ++i) {
+    const std::int32_t t0 = tables.dwm.termarr_flat[3 * i];
+    const std::int32_t t1 = tables.dwm.termarr_flat[3 * i + 1];
+    const std::int32_t t2 = tables.dwm.termarr_flat[3 * i + 2];
+    prog.vsh[i] = t0 == kDwmNoTerm ? tables.nvshterm : t0;
+    prog.kp[i] = static_cast<std::uint8_t>(t1 == kDwmNoTerm ? 3 : t1);
+    prog.lat[i] = t2 == kDwmNoTerm ? 0 : 1;
+    prog.coeff[i] = tables.dwm.coeff[i];
+  }
+  return true;
+}
 
-  impl->normadj.assign(static_cast<std::size_t>(impl->gd2qd.nmax + 1), 0.0);
-  for (int n = 0; n <= impl->gd2qd.nmax; ++n) {
-    impl->normadj[static_cast<std::size_t>(n)] = std::sqrt(static_cast<double>(n * (n + 1)));
+std::optional<Error> ValidateEvalOptions(const Options& options, std::string_view where) {
+  const double step = options.qd_grid_step_deg;
+  if (step == 0.0) {
+    return std::nullopt;
   }
+  const double cells = 180.0 / step;
+  if (!std::isfinite(step) || step < 0.25 || step > 30.0 || std::abs(cells - std::round(cells)) > 1e-9) {
+    return MakeError(ErrorCode::kInvalidInput, "qd_grid_step_deg must be 0 or divide 180 within [0.25, 30]",
+                     std::to_string(step), std::string(where));
+  }
+  return std::nullopt;
+}
 
-  impl->tparm.assign(impl->hwm.mparm.size(), 0.0);
-  const int last_level = impl->hwm.nlev - impl->hwm.p - 1;
-  for (int i = 0; i <= last_level; ++i) {
-    std::array<int, 8> order{};
-    for (int k = 0; k < 8; ++k) {
-      order[static_cast<std::size_t>(k)] = impl->hwm.order[HwmOrderIdx(k, i, impl->hwm.ncomp)];
+std::optional<Error> ValidateBlobOptions(const Options& options, std::string_view where) {
+  if (options.altitude_band) {
+    return MakeError(ErrorCode::kInvalidInput,
+                     "blobs always carry every level; Options::altitude_band is not supported", {}, std::string(where));
+  }
+  return ValidateEvalOptions(options, where);
+}
+
+void FillQuietHarmonics(const Model::Impl& impl, const Inputs& in, QuietHarmonics& out) {
+  FillSeasonalHarmonics(impl.hwm, in, out.fs);
+  FillLocalTimeHarmonics(impl.hwm, in, out.fl);
+  FillLongitudeHarmonics(impl.hwm, in, out.fm);
+  FillColatitudeSines(impl.hwm, in, out.sn);
+}
+
+Winds QuietWindsWithHarmonics(const Model::Impl& impl, const Inputs& in, const QuietHarmonics& harmonics) {
+  auto& scratch = ThreadQuietScratch();
+  PrepareQuietLocation(impl, in, scratch);
+  return impl.mparm_f32.empty() ? QuietLevelsSum(impl, harmonics, scratch)
+                                : QuietLevelsSumF32(impl, harmonics, scratch);
+}
+
+void FillMltHarmonics(const DisturbanceTables& dist, double mlt_h, std::vector<std::array<double, 2>>& out) {
+  out.resize(static_cast<std::size_t>(dist.dwm.mmax + 1));
+  FillDwmMltTerms(dist, mlt_h, out.data());
+}
+
+Winds DisturbanceWindsWithMltHarmonics(const DisturbanceTables& dist,
+                                       const Inputs& in,
+                                       const QdCoordinates& qd,
+                                       std::span<const std::array<double, 2>> mlt,
+                                       bool fold_kp) {
+  return DisturbanceWindsFromQd(dist, in, qd, fold_kp, mlt.data());
+}
+
+std::optional<Error> ValidateInputs(const Model::Impl& impl, const Inputs& in, std::string_view where) {
+  auto valid = ValidateQuietInputs(impl, in, where);
+  if (!valid) {
+    return valid.error();
+  }
+  return std::nullopt;
+}
+
+void BindEvalOptions(Model::Impl& impl, const Options& options) {
+  impl.fast_fp = !options.strict_fp && detail::fast_fp::Available();
+  if (options.single_precision) {
+    impl.mparm_f32.assign(impl.mparm.begin(), impl.mparm.end());
+    impl.tparm_f32.assign(impl.tparm.begin(), impl.tparm.end());
+  }
+  if (options.qd_grid_step_deg > 0.0) {
+    impl.qd_grid = std::make_shared<LazyQdGrid>();
+    impl.qd_grid->step_deg = options.qd_grid_step_deg;
+    if (impl.disturbance) {
+      (void)ResolveQdGrid(impl, *impl.disturbance);
     }
+  }
+}
 
-    std::vector<double> mcol(static_cast<std::size_t>(impl->hwm.nbf), 0.0);
-    std::vector<double> tcol(static_cast<std::size_t>(impl->hwm.nbf), 0.0);
-    const std::size_t off = static_cast<std::size_t>(impl->hwm.nbf) * static_cast<std::size_t>(i);
-    std::copy_n(impl->hwm.mparm.begin() + static_cast<std::ptrdiff_t>(off), impl->hwm.nbf, mcol.begin());
+}  // namespace detail
 
-    ParityColumn(order, impl->hwm.nb[static_cast<std::size_t>(i)], mcol, tcol, impl->hwm.nbf);
+Result<Model, Error> Model::LoadFromResolvedPaths(DataPaths paths, Options options) {
+  if (auto err = ValidateAltitudeBand(options, "Model::LoadFromResolvedPaths")) {
+    return Result<Model, Error>::Err(std::move(*err));
+  }
+  if (auto err = detail::ValidateEvalOptions(options, "Model::LoadFromResolvedPaths")) {
+    return Result<Model, Error>::Err(std::move(*err));
+  }
+  const bool eager_disturbance = !options.quiet_only && !options.lazy_disturbance;
+
+  // The small QD and DWM files are read on helper threads while this thread parses the large
+  // coefficient file; errors are reported in the same order as the serial path.
+  const bool concurrent_reads = options.parallel_load && eager_disturbance;
+  std::future<Result<detail::Gd2qdData, Error>> gd2qd_task;
+  std::future<Result<detail::DwmData, Error>> dwm_task;
+  if (concurrent_reads) {
+    gd2qd_task = std::async(std::launch::async | std::launch::deferred, detail::LoadGd2qdData, paths.gd2qd_dat);
+    dwm_task = std::async(std::launch::async | std::launch::deferred, detail::LoadDwmData, paths.dwm_dat);
+  }
 
-    std::copy(mcol.begin(), mcol.end(), impl->hwm.mparm.begin() + static_cast<std::ptrdiff_t>(off));
-    std::copy(tcol.begin(), tcol.end(), impl->tparm.begin() + static_cast<std::ptrdiff_t>(off));
+  auto hwm = detail::LoadHwmBinHeader(paths.hwm_bin);
+  std::optional<DisturbanceSources> sources;
+  if (eager_disturbance) {
+    auto gd2qd = concurrent_reads ? gd2qd_task.get() : detail::LoadGd2qdData(paths.gd2qd_dat);
+    auto dwm = concurrent_reads ? dwm_task.get() : detail::LoadDwmData(paths.dwm_dat);
+    if (!hwm) {
+      return Result<Model, Error>::Err(hwm.error());
+    }
+    if (!gd2qd) {
+      return Result<Model, Error>::Err(gd2qd.error());
+    }
+    if (!dwm) {
+      return Result<Model, Error>::Err(dwm.error());
+    }
+    sources = DisturbanceSources{std::move(gd2qd.value()), std::move(dwm.value())};
+  }
+  if (!hwm) {
+    return Result<Model, Error>::Err(hwm.error());
   }
 
-  impl->nvshterm =
-      ((((impl->dwm.nmax + 1) * (impl->dwm.nmax + 2) - (impl->dwm.nmax - impl->dwm.mmax) * (impl->dwm.nmax - impl->dwm.mmax + 1)) /
-        2) -
-       1) *
-          4 -
-      2 * impl->dwm.nmax;
+  auto impl = BuildImpl(std::move(paths), std::move(hwm.value()), std::move(sources), LoadWorkers(options),
+                        options.altitude_band);
+  detail::BindEvalOptions(*impl, options);
+  if (!options.quiet_only && options.lazy_disturbance) {
+    auto lazy = std::make_shared<detail::LazyDisturbance>();
+    lazy->paths = impl->paths;
+    lazy->quiet_maxn = impl->hwm.maxn;
+    lazy->quiet_maxo = impl->maxo;
+    impl->lazy_disturbance = std::move(lazy);
+  }
+  return Result<Model, Error>::Ok(Model(std::move(impl), std::move(options)));
+}
 
+Result<Model, Error> Model::LoadFromMemory(std::span<const std::byte> hwm_bin,
+                                           std::span<const std::byte> dwm_dat,
+                                           std::span<const std::byte> gd2qd_dat,
+                                           Options options) {
+  if (auto err = ValidateAltitudeBand(options, "Model::LoadFromMemory")) {
+    return Result<Model, Error>::Err(std::move(*err));
+  }
+  if (auto err = detail::ValidateEvalOptions(options, "Model::LoadFromMemory")) {
+    return Result<Model, Error>::Err(std::move(*err));
+  }
+  auto hwm = detail::ParseHwmBinHeader(hwm_bin, "<memory:hwm123114.bin>");
+  if (!hwm) {
+    return Result<Model, Error>::Err(hwm.error());
+  }
+
+  // The caller's buffers need not outlive this call, so `lazy_disturbance` parses them eagerly here.
+  std::optional<DisturbanceSources> sources;
+  if (!options.quiet_only) {
+    auto gd2qd = detail::ParseGd2qdData(gd2qd_dat, "<memory:gd2qd.dat>");
+    if (!gd2qd) {
+      return Result<Model, Error>::Err(gd2qd.error());
+    }
+
+    auto dwm = detail::ParseDwmData(dwm_dat, "<memory:dwm07b104i.dat>");
+    if (!dwm) {
+      return Result<Model, Error>::Err(dwm.error());
+    }
+    sources = DisturbanceSources{std::move(gd2qd.value()), std::move(dwm.value())};
+  }
+
+  auto impl = BuildImpl(DataPaths{}, std::move(hwm.value()), std::move(sources), LoadWorkers(options),
+                        options.altitude_band);
+  detail::BindEvalOptions(*impl, options);
   return Result<Model, Error>::Ok(Model(std::move(impl), std::move(options)));
 }
 
@@ -922,13 +1700,65 @@ Result<Model, Error> Model::LoadFromDirectory(std::filesystem::path data_dir, Op
 Result<Model, Error> Model::LoadWithSearchPaths(Options options) {
   auto paths = ResolveDataPathsWithSearchPaths(options);
   if (!paths) {
+#ifdef HWM14_EMBEDDED_DATA
+    return LoadEmbedded(std::move(options));
+#else
     return Result<Model, Error>::Err(paths.error());
+#endif
   }
   return LoadFromResolvedPaths(std::move(paths.value()), std::move(options));
 }
 
+Result<Model, Error> Model::LoadEmbedded(Options options) {
+#ifdef HWM14_EMBEDDED_DATA
+  return LoadFromMemory(detail::EmbeddedHwmBin(), detail::EmbeddedDwmDat(), detail::EmbeddedGd2qdDat(),
+                        std::move(options));
+#else
+  (void)options;
+  return Result<Model, Error>::Err(MakeError(
+      ErrorCode::kNotImplemented, "library built without embedded data (HWM14_EMBED_DATA=OFF)", {}, "Model::LoadEmbedded"));
+#endif
+}
+
+Result<Model, Error> Model::LoadFromBlob(const std::filesystem::path& blob_path, Options options) {
+  if (auto err = detail::ValidateBlobOptions(options, "Model::LoadFromBlob")) {
+    return Result<Model, Error>::Err(std::move(*err));
+  }
+  auto mapped = detail::MappedFile::Open(blob_path);
+  if (!mapped) {
+    return Result<Model, Error>::Err(mapped.error());
+  }
+  const auto bytes = mapped.value()->bytes();
+  auto impl = detail::ModelImplFromBlob(bytes, mapped.value(), options.verify_blob_checksum, "Model::LoadFromBlob");
+  if (!impl) {
+    auto err = impl.error();
+    err.detail = blob_path.string() + (err.detail.empty() ? "" : ": " + err.detail);
+    return Result<Model, Error>::Err(std::move(err));
+  }
+  detail::BindEvalOptions(*impl.value(), options);
+  return Result<Model, Error>::Ok(Model(std::move(impl.value()), std::move(options)));
+}
+
+Result<std::size_t, Error> Model::SaveBlob(const std::filesystem::path& blob_path) const {
+  const auto blob = detail::SerializeModelBlob(*impl_);
+  if (!blob) {
+    return Result<std::size_t, Error>::Err(blob.error());
+  }
+  std::ofstream out(blob_path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    return Result<std::size_t, Error>::Err(
+        MakeError(ErrorCode::kDataFileOpenFailed, "failed to open blob for writing", blob_path.string(), "Model::SaveBlob"));
+  }
+  out.write(reinterpret_cast<const char*>(blob.value().data()), static_cast<std::streamsize>(blob.value().size()));
+  if (!out) {
+    return Result<std::size_t, Error>::Err(
+        MakeError(ErrorCode::kDataFileOpenFailed, "failed writing blob", blob_path.string(), "Model::SaveBlob"));
+  }
+  return Result<std::size_t, Error>::Ok(blob.value().size());
+}
+
 Result<Winds, Error> Model::TotalWinds(const Inputs& in) const {
-  const auto valid = ValidateCommonInputs(in, "Model::TotalWinds");
+  const auto valid = ValidateQuietInputs(*impl_, in, "Model::TotalWinds");
   if (!valid) {
     return Result<Winds, Error>::Err(valid.error());
   }
@@ -953,10 +1783,13 @@ Result<Winds, Error> Model::TotalWinds(const Inputs& in) const {
 }
 
 Result<Winds, Error> Model::QuietWinds(const Inputs& in) const {
-  const auto valid = ValidateCommonInputs(in, "Model::QuietWinds");
+  const auto valid = ValidateQuietInputs(*impl_, in, "Model::QuietWinds");
   if (!valid) {
     return Result<Winds, Error>::Err(valid.error());
   }
+  if (!impl_->mparm_f32.empty()) {
+    return QuietWindsF32Impl(*impl_, in);
+  }
   return QuietWindsImpl(*impl_, in);
 }
 
@@ -969,30 +1802,259 @@ Result<Winds, Error> Model::DisturbanceWindsGeo(const Inputs& in) const {
     return Result<Winds, Error>::Ok(Winds{});
   }
 
-  const auto tr = Gd2qdImpl(*impl_, in.geodetic_lat_deg, in.geodetic_lon_deg);
+  const auto dist = detail::ResolveDisturbance(*impl_, "Model::DisturbanceWindsGeo");
+  if (!dist) {
+    return Result<Winds, Error>::Err(dist.error());
+  }
+  const auto& tables = *dist.value();
+
+  const auto tr = Gd2qdFor(*impl_, tables, in.geodetic_lat_deg, in.geodetic_lon_deg);
   if (!tr) {
     return Result<Winds, Error>::Err(tr.error());
   }
 
   const double day = static_cast<double>(in.yyddd % 1000);
   const double ut = detail::NormalizeUtSeconds(in.ut_seconds) / 3600.0;
-  const double kp = Ap2Kp(in.ap3);
-  const double mlt = MltCalcImpl(*impl_, tr.value().qlat, tr.value().qlon, day, ut);
+  const double mlt = MltCalcImpl(tables, tr.value().qlat, tr.value().qlon, day, ut);
+  return Result<Winds, Error>::Ok(
+      DisturbanceWindsFromQd(tables, in, ToQdCoordinates(tr.value(), mlt), options_.enable_cache));
+}
 
-  auto mag = DisturbanceWindsMag(mlt, tr.value().qlat, kp);
-  if (!mag) {
-    return mag;
+Result<Winds, Error> Model::DisturbanceWindsGeo(const Inputs& in, const QdCoordinates& qd) const {
+  const auto valid = ValidateCommonInputs(in, "Model::DisturbanceWindsGeo");
+  if (!valid) {
+    return Result<Winds, Error>::Err(valid.error());
+  }
+  if (!std::isfinite(qd.qlat_deg) || !std::isfinite(qd.mlt_h) || !std::isfinite(qd.f1_east) ||
+      !std::isfinite(qd.f1_north) || !std::isfinite(qd.f2_east) || !std::isfinite(qd.f2_north)) {
+    return Result<Winds, Error>::Err(
+        MakeError(ErrorCode::kInvalidInput, "QD coordinates must be finite", {}, "Model::DisturbanceWindsGeo"));
+  }
+  if (in.ap3 < 0.0) {
+    return Result<Winds, Error>::Ok(Winds{});
   }
 
-  Winds dw{};
-  dw.meridional_mps = tr.value().f2n * mag.value().meridional_mps + tr.value().f1n * mag.value().zonal_mps;
-  dw.zonal_mps = tr.value().f2e * mag.value().meridional_mps + tr.value().f1e * mag.value().zonal_mps;
+  const auto dist = detail::ResolveDisturbance(*impl_, "Model::DisturbanceWindsGeo");
+  if (!dist) {
+    return Result<Winds, Error>::Err(dist.error());
+  }
+  return Result<Winds, Error>::Ok(DisturbanceWindsFromQd(*dist.value(), in, qd, options_.enable_cache));
+}
 
-  const double height_scale = 1.0 + std::exp(-(in.altitude_km - 125.0) / impl_->dwm.twidth);
-  dw.meridional_mps /= height_scale;
-  dw.zonal_mps /= height_scale;
+Result<QdCoordinates, Error> Model::GeoToQd(const Inputs& in) const {
+  const auto valid = ValidateCommonInputs(in, "Model::GeoToQd");
+  if (!valid) {
+    return Result<QdCoordinates, Error>::Err(valid.error());
+  }
+  const auto dist = detail::ResolveDisturbance(*impl_, "Model::GeoToQd");
+  if (!dist) {
+    return Result<QdCoordinates, Error>::Err(dist.error());
+  }
+  const auto& tables = *dist.value();
+
+  const auto tr = Gd2qdFor(*impl_, tables, in.geodetic_lat_deg, in.geodetic_lon_deg);
+  if (!tr) {
+    return Result<QdCoordinates, Error>::Err(tr.error());
+  }
+  const double day = static_cast<double>(in.yyddd % 1000);
+  const double ut = detail::NormalizeUtSeconds(in.ut_seconds) / 3600.0;
+  const double mlt = MltCalcImpl(tables, tr.value().qlat, tr.value().qlon, day, ut);
+  return Result<QdCoordinates, Error>::Ok(ToQdCoordinates(tr.value(), mlt));
+}
+
+Result<std::size_t, Error> Model::GeoToQdBatch(std::span<const Inputs> in, const QdCoordinateColumns& out) const {
+  using R = Result<std::size_t, Error>;
+  for (const auto col : {out.qlat_deg, out.qlon_deg, out.mlt_h, out.f1_east, out.f1_north, out.f2_east, out.f2_north}) {
+    if (!col.empty() && col.size() < in.size()) {
+      return R::Err(MakeError(ErrorCode::kInvalidInput, "output column shorter than the input batch",
+                              std::to_string(col.size()), "Model::GeoToQdBatch"));
+    }
+  }
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto valid = ValidateCommonInputs(in[i], "Model::GeoToQdBatch");
+    if (!valid) {
+      auto err = valid.error();
+      err.detail = "row " + std::to_string(i);
+      return R::Err(std::move(err));
+    }
+  }
+  const auto dist = detail::ResolveDisturbance(*impl_, "Model::GeoToQdBatch");
+  if (!dist) {
+    return R::Err(dist.error());
+  }
+  const auto& tables = *dist.value();
 
-  return Result<Winds, Error>::Ok(dw);
+  const auto put = [](std::span<double> col, std::size_t i, double v) {
+    if (!col.empty()) {
+      col[i] = v;
+    }
+  };
+  // Consecutive rows at the same epoch share the subsolar QD longitude.
+  double day = std::numeric_limits<double>::quiet_NaN();
+  double ut = std::numeric_limits<double>::quiet_NaN();
+  double asunqlon = 0.0;
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto tr = Gd2qdFor(*impl_, tables, in[i].geodetic_lat_deg, in[i].geodetic_lon_deg);
+    if (!tr) {
+      return R::Err(tr.error());
+    }
+    put(out.qlat_deg, i, tr.value().qlat);
+    put(out.qlon_deg, i, tr.value().qlon);
+    put(out.f1_east, i, tr.value().f1e);
+    put(out.f1_north, i, tr.value().f1n);
+    put(out.f2_east, i, tr.value().f2e);
+    put(out.f2_north, i, tr.value().f2n);
+    if (out.mlt_h.empty()) {
+      continue;
+    }
+    const double row_day = static_cast<double>(in[i].yyddd % 1000);
+    const double row_ut = detail::NormalizeUtSeconds(in[i].ut_seconds) / 3600.0;
+    if (row_day != day || row_ut != ut) {
+      day = row_day;
+      ut = row_ut;
+      asunqlon = SubsolarQdLon(tables, day, ut);
+    }
+    out.mlt_h[i] = (tr.value().qlon - asunqlon) / 15.0;
+  }
+  return R::Ok(in.size());
+}
+
+Result<BatchReuseReport, Error> Model::TotalWindsScheduled(std::span<const Inputs> in, std::span<Winds> out) const {
+  using R = Result<BatchReuseReport, Error>;
+  constexpr const char* kWhere = "Model::TotalWindsScheduled";
+  if (out.size() < in.size()) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput, "output buffer smaller than the input batch",
+                            std::to_string(out.size()), kWhere));
+  }
+  bool disturbed = false;
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto valid = ValidateQuietInputs(*impl_, in[i], kWhere);
+    if (!valid) {
+      auto err = valid.error();
+      err.detail = "row " + std::to_string(i);
+      return R::Err(std::move(err));
+    }
+    disturbed = disturbed || in[i].ap3 >= 0.0;
+  }
+  std::shared_ptr<const detail::DisturbanceTables> tables;
+  if (disturbed) {
+    auto dist = detail::ResolveDisturbance(*impl_, kWhere);
+    if (!dist) {
+      return R::Err(dist.error());
+    }
+    tables = std::move(dist.value());
+  }
+
+  // Epoch first (subsolar point, seasonal and local-time harmonics), then the active level band
+  // (coefficient columns), then latitude (ALF basis) and longitude (QD transform).
+  std::vector<int> lev(in.size());
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    lev[i] = VertLevel(in[i].altitude_km, impl_->hwm);
+  }
+  std::vector<std::size_t> order(in.size());
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+    const auto& x = in[a];
+    const auto& y = in[b];
+    return std::tie(x.yyddd, x.ut_seconds, lev[a], x.geodetic_lat_deg, x.geodetic_lon_deg, x.altitude_km, a) <
+           std::tie(y.yyddd, y.ut_seconds, lev[b], y.geodetic_lat_deg, y.geodetic_lon_deg, y.altitude_km, b);
+  });
+
+  BatchReuseReport report{};
+  report.samples = in.size();
+  auto& scratch = ThreadQuietScratch();
+  const Inputs* prev = nullptr;
+  const Inputs* qd_row = nullptr;
+  Gd2qdTransform tr{};
+  double day = std::numeric_limits<double>::quiet_NaN();
+  double ut = std::numeric_limits<double>::quiet_NaN();
+  double asunqlon = 0.0;
+  for (const std::size_t i : order) {
+    const auto& row = in[i];
+    if (prev == nullptr || row.yyddd != prev->yyddd || row.ut_seconds != prev->ut_seconds) {
+      ++report.epochs;
+    }
+    PrepareQuietBasisAfter(*impl_, row, prev, scratch, report);
+    prev = &row;
+    const Winds q = impl_->mparm_f32.empty() ? QuietLevelsSum(*impl_, scratch, scratch)
+                                             : QuietLevelsSumF32(*impl_, scratch, scratch);
+    if (row.ap3 < 0.0) {
+      out[i] = q;
+      continue;
+    }
+
+    if (qd_row != nullptr && qd_row->geodetic_lat_deg == row.geodetic_lat_deg &&
+        qd_row->geodetic_lon_deg == row.geodetic_lon_deg) {
+      ++report.qd_reuses;
+    } else {
+      const auto next = Gd2qdFor(*impl_, *tables, row.geodetic_lat_deg, row.geodetic_lon_deg);
+      if (!next) {
+        auto err = next.error();
+        err.detail = "row " + std::to_string(i);
+        return R::Err(std::move(err));
+      }
+      tr = next.value();
+      qd_row = &row;
+    }
+    const double row_day = static_cast<double>(row.yyddd % 1000);
+    const double row_ut = detail::NormalizeUtSeconds(row.ut_seconds) / 3600.0;
+    if (row_day != day || row_ut != ut) {
+      day = row_day;
+      ut = row_ut;
+      asunqlon = SubsolarQdLon(*tables, day, ut);
+    } else {
+      ++report.subsolar_reuses;
+    }
+    const double mlt = (tr.qlon - asunqlon) / 15.0;
+    const Winds d = DisturbanceWindsFromQd(*tables, row, ToQdCoordinates(tr, mlt), options_.enable_cache);
+
+    Winds w{};
+    w.meridional_mps = q.meridional_mps + d.meridional_mps;
+    w.zonal_mps = q.zonal_mps + d.zonal_mps;
+    out[i] = w;
+  }
+  return R::Ok(report);
+}
+
+Result<QdGridValidation, Error> Model::ValidateQdGrid() const {
+  using R = Result<QdGridValidation, Error>;
+  if (!impl_->qd_grid) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput, "model uses the exact QD transform (Options::qd_grid_step_deg)",
+                            {}, "Model::ValidateQdGrid"));
+  }
+  const auto dist = detail::ResolveDisturbance(*impl_, "Model::ValidateQdGrid");
+  if (!dist) {
+    return R::Err(dist.error());
+  }
+  const auto& tables = *dist.value();
+  const auto& grid = *ResolveQdGrid(*impl_, tables);
+
+  QdGridValidation report{};
+  report.step_deg = grid.step_deg;
+  const auto compare = [&](double glat, double glon) {
+    const auto exact = Gd2qdImpl(tables, glat, glon).value();
+    const auto approx = Gd2qdFromGrid(grid, tables, glat, glon);
+    const double dlon = std::fmod(std::abs(exact.qlon - approx.qlon), 360.0);
+    report.max_qlat_err_deg = std::max(report.max_qlat_err_deg, std::abs(exact.qlat - approx.qlat));
+    report.max_qlon_arc_err_deg =
+        std::max(report.max_qlon_arc_err_deg, std::min(dlon, 360.0 - dlon) * std::cos(exact.qlat * kDtor));
+    report.max_f_err = std::max({report.max_f_err, std::abs(exact.f1e - approx.f1e), std::abs(exact.f1n - approx.f1n),
+                                 std::abs(exact.f2e - approx.f2e), std::abs(exact.f2n - approx.f2n)});
+    ++report.samples;
+  };
+  // Catmull-Rom error does not peak at one fixed fraction of a cell, so sample a 4 x 4 sub-grid.
+  constexpr int kSub = 4;
+  const double sub = grid.step_deg / kSub;
+  for (int i = 0; i + 1 < grid.nlat; ++i) {
+    for (int j = 0; j < grid.nlon; ++j) {
+      for (int a = 0; a < kSub; ++a) {
+        for (int b = (a == 0 ? 1 : 0); b < kSub; ++b) {
+          compare(-90.0 + grid.step_deg * i + sub * a, -180.0 + grid.step_deg * j + sub * b);
+        }
+      }
+    }
+  }
+  return R::Ok(report);
 }
 
 Result<Winds, Error> Model::DisturbanceWindsMag(double mlt_h, double mlat_deg, double kp) const {
@@ -1000,7 +2062,239 @@ Result<Winds, Error> Model::DisturbanceWindsMag(double mlt_h, double mlat_deg, d
     return Result<Winds, Error>::Err(
         MakeError(ErrorCode::kInvalidInput, "inputs must be finite", {}, "Model::DisturbanceWindsMag"));
   }
-  return DisturbanceWindsMagImpl(*impl_, mlt_h, mlat_deg, kp);
+  const auto dist = detail::ResolveDisturbance(*impl_, "Model::DisturbanceWindsMag");
+  if (!dist) {
+    return Result<Winds, Error>::Err(dist.error());
+  }
+  return DisturbanceWindsMagImpl(*dist.value(), mlt_h, mlat_deg, kp, options_.enable_cache);
+}
+
+Result<std::size_t, Error> Model::DisturbanceWindsMagGrid(std::span<const double> mlat_deg,
+                                                         std::span<const double> mlt_h,
+                                                         std::span<const double> kp,
+                                                         std::span<Winds> out,
+                                                         std::size_t kp_stride) const {
+  using R = Result<std::size_t, Error>;
+  const auto all_finite = [](std::span<const double> v) {
+    return std::all_of(v.begin(), v.end(), [](double x) { return std::isfinite(x); });
+  };
+  if (!all_finite(mlat_deg) || !all_finite(mlt_h) || !all_finite(kp)) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput, "inputs must be finite", {}, "Model::DisturbanceWindsMagGrid"));
+  }
+  const std::size_t slab = mlat_deg.size() * mlt_h.size();
+  if (kp_stride == 0) {
+    kp_stride = slab;
+  }
+  if (kp_stride < slab) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput, "kp_stride smaller than mlat x MLT cells",
+                            std::to_string(kp_stride), "Model::DisturbanceWindsMagGrid"));
+  }
+  if (slab == 0 || kp.empty()) {
+    return R::Ok(0);
+  }
+  if (out.size() < slab || (out.size() - slab) / kp_stride < kp.size() - 1) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput, "output buffer smaller than (kp - 1) x kp_stride + cells",
+                            std::to_string(out.size()), "Model::DisturbanceWindsMagGrid"));
+  }
+  const auto dist = detail::ResolveDisturbance(*impl_, "Model::DisturbanceWindsMagGrid");
+  if (!dist) {
+    return R::Err(dist.error());
+  }
+  DisturbanceWindsMagGridImpl(*dist.value(), mlat_deg, mlt_h, kp, kp_stride, options_.enable_cache, out.data());
+  return R::Ok(slab * kp.size());
+}
+
+std::size_t Model::QuietDesignColumns() const {
+  return impl_->mparm.size();
+}
+
+std::size_t Model::QuietFirstLevel() const {
+  return static_cast<std::size_t>(impl_->level_first);
+}
+
+std::size_t Model::QuietTermsPerLevel() const {
+  return static_cast<std::size_t>(impl_->hwm.nbf);
+}
+
+std::span<const double> Model::QuietZonalCoefficients() const {
+  return impl_->mparm;
+}
+
+std::span<const double> Model::QuietMeridionalCoefficients() const {
+  return impl_->tparm;
+}
+
+Result<std::size_t, Error> Model::QuietDesignMatrixDense(std::span<const Inputs> in, std::span<double> out) const {
+  const std::size_t ncol = QuietDesignColumns();
+  if (out.size() / ncol < in.size()) {
+    return Result<std::size_t, Error>::Err(MakeError(ErrorCode::kInvalidInput,
+                                                     "output buffer smaller than rows x QuietDesignColumns()",
+                                                     std::to_string(out.size()),
+                                                     "Model::QuietDesignMatrixDense"));
+  }
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto valid = ValidateQuietInputs(*impl_, in[i], "Model::QuietDesignMatrixDense");
+    if (!valid) {
+      auto err = valid.error();
+      err.detail = "row " + std::to_string(i);
+      return Result<std::size_t, Error>::Err(std::move(err));
+    }
+  }
+
+  const auto nbf = static_cast<std::size_t>(impl_->hwm.nbf);
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    double* row = out.data() + i * ncol;
+    std::fill_n(row, ncol, 0.0);
+    EmitQuietDesignRow(*impl_, in[i], [&](int level, int offset, double value) {
+      row[static_cast<std::size_t>(level) * nbf + static_cast<std::size_t>(offset)] = value;
+    });
+  }
+  return Result<std::size_t, Error>::Ok(in.size());
+}
+
+Result<std::size_t, Error> Model::AppendQuietDesignRows(std::span<const Inputs> in, SparseDesignMatrix& out) const {
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto valid = ValidateQuietInputs(*impl_, in[i], "Model::AppendQuietDesignRows");
+    if (!valid) {
+      auto err = valid.error();
+      err.detail = "row " + std::to_string(i);
+      return Result<std::size_t, Error>::Err(std::move(err));
+    }
+  }
+
+  if (out.row_ptr.empty()) {
+    out.row_ptr.push_back(out.entries.size());
+  }
+  out.row_ptr.reserve(out.row_ptr.size() + in.size());
+  for (const auto& x : in) {
+    EmitQuietDesignRow(*impl_, x, [&](int level, int offset, double value) {
+      out.entries.push_back(DesignEntry{level, offset, value});
+    });
+    out.row_ptr.push_back(out.entries.size());
+  }
+  return Result<std::size_t, Error>::Ok(in.size());
+}
+
+Result<Model, Error> Model::WithEnsembleMembers(std::vector<std::vector<double>> raw_mparm_sets) const {
+  const auto& h = impl_->hwm;
+  const auto nbf = static_cast<std::size_t>(h.nbf);
+  for (std::size_t j = 0; j < raw_mparm_sets.size(); ++j) {
+    if (raw_mparm_sets[j].size() != nbf * static_cast<std::size_t>(h.nlev + 1)) {
+      return Result<Model, Error>::Err(MakeError(ErrorCode::kInvalidInput,
+                                                 "ensemble member size does not match nbf * (nlev + 1)",
+                                                 "member " + std::to_string(j),
+                                                 "Model::WithEnsembleMembers"));
+    }
+  }
+
+  // Members cover the same levels as the base coefficients, so banded models stay banded.
+  auto impl = std::make_shared<Model::Impl>(*impl_);
+  const auto nlev1 = impl->mparm.size() / nbf;
+  const auto first = static_cast<std::size_t>(impl->level_first);
+  const auto old_members = static_cast<std::size_t>(impl->ensemble_members);
+  const auto members = old_members + raw_mparm_sets.size();
+
+  std::vector<double> ens_mparm(nbf * members * nlev1, 0.0);
+  std::vector<double> ens_tparm(nbf * members * nlev1, 0.0);
+  for (std::size_t d = 0; d < nlev1; ++d) {
+    for (std::size_t j = 0; j < old_members; ++j) {
+      const std::size_t from = nbf * (old_members * d + j);
+      const std::size_t to = nbf * (members * d + j);
+      std::copy_n(impl->ens_mparm.begin() + static_cast<std::ptrdiff_t>(from), nbf,
+                  ens_mparm.begin() + static_cast<std::ptrdiff_t>(to));
+      std::copy_n(impl->ens_tparm.begin() + static_cast<std::ptrdiff_t>(from), nbf,
+                  ens_tparm.begin() + static_cast<std::ptrdiff_t>(to));
+    }
+  }
+
+  // Raw members are in the loaded layout: after `WithTruncation` the parity split uses the loaded order
+  // table, and the columns are remapped onto the truncated one as the base columns were.
+  const bool truncated = !impl->loaded_order.empty();
+  detail::HwmBinHeader loaded = h;
+  if (truncated) {
+    loaded.order = impl->loaded_order;
+  }
+  std::vector<double> tparm;
+  for (std::size_t j = 0; j < raw_mparm_sets.size(); ++j) {
+    auto& mparm = raw_mparm_sets[j];
+    DeriveParityColumns(loaded, mparm, tparm);
+    for (std::size_t d = 0; d < nlev1; ++d) {
+      const auto src_m = std::span<const double>(mparm).subspan(nbf * (first + d), nbf);
+      const auto src_t = std::span<const double>(tparm).subspan(nbf * (first + d), nbf);
+      const auto dst_m = std::span<double>(ens_mparm).subspan(nbf * (members * d + old_members + j), nbf);
+      const auto dst_t = std::span<double>(ens_tparm).subspan(nbf * (members * d + old_members + j), nbf);
+      if (truncated) {
+        const int level = static_cast<int>(first + d);
+        detail::RemapQuietLevelColumn(loaded, h, level, src_m, dst_m);
+        detail::RemapQuietLevelColumn(loaded, h, level, src_t, dst_t);
+      } else {
+        std::copy(src_m.begin(), src_m.end(), dst_m.begin());
+        std::copy(src_t.begin(), src_t.end(), dst_t.begin());
+      }
+    }
+  }
+
+  impl->ensemble_members = static_cast<int>(members);
+  impl->ens_mparm = std::move(ens_mparm);
+  impl->ens_tparm = std::move(ens_tparm);
+  return Result<Model, Error>::Ok(Model(std::move(impl), options_));
+}
+
+Result<Model, Error> Model::WithEnsembleMembersFromFiles(std::span<const std::filesystem::path> hwm_bins) const {
+  const auto& h = impl_->hwm;
+  std::vector<std::vector<double>> sets;
+  sets.reserve(hwm_bins.size());
+  for (const auto& path : hwm_bins) {
+    auto member = detail::LoadHwmBinHeader(path);
+    if (!member) {
+      return Result<Model, Error>::Err(member.error());
+    }
+    const auto& mh = member.value();
+    const auto& order = impl_->loaded_order.empty() ? h.order : impl_->loaded_order;
+    if (mh.nbf != h.nbf || mh.nlev != h.nlev || mh.p != h.p || mh.ncomp != h.ncomp || mh.order != order) {
+      return Result<Model, Error>::Err(MakeError(ErrorCode::kInvalidInput,
+                                                 "ensemble member layout does not match base model",
+                                                 path.string(),
+                                                 "Model::WithEnsembleMembersFromFiles"));
+    }
+    sets.push_back(std::move(member.value().mparm));
+  }
+  return WithEnsembleMembers(std::move(sets));
+}
+
+bool Model::RelaxedFpKernels() const {
+  return impl_->fast_fp;
+}
+
+std::size_t Model::EnsembleSize() const {
+  return static_cast<std::size_t>(impl_->ensemble_members);
+}
+
+Result<std::size_t, Error> Model::QuietWindsEnsemble(std::span<const Inputs> in, std::span<Winds> out) const {
+  const std::size_t members = EnsembleSize();
+  if (members == 0) {
+    return Result<std::size_t, Error>::Err(
+        MakeError(ErrorCode::kInvalidInput, "model has no ensemble members", {}, "Model::QuietWindsEnsemble"));
+  }
+  if (out.size() / members < in.size()) {
+    return Result<std::size_t, Error>::Err(MakeError(ErrorCode::kInvalidInput,
+                                                     "output buffer smaller than rows x EnsembleSize()",
+                                                     std::to_string(out.size()),
+                                                     "Model::QuietWindsEnsemble"));
+  }
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto valid = ValidateQuietInputs(*impl_, in[i], "Model::QuietWindsEnsemble");
+    if (!valid) {
+      auto err = valid.error();
+      err.detail = "row " + std::to_string(i);
+      return Result<std::size_t, Error>::Err(std::move(err));
+    }
+  }
+
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    QuietWindsEnsembleImpl(*impl_, in[i], out.data() + i * members);
+  }
+  return Result<std::size_t, Error>::Ok(in.size());
 }
 
 Result<Winds, Error> Model::Evaluate(const Inputs& in) const {
@@ -5,51 +5,61 @@
 
 #include "hwm14/detail/hwm_bin_loader.hpp"
 
-#include <fstream>
+#include <string>
 #include <vector>
 
+#include "hwm14/detail/fortran_unformatted.hpp"
+#include "hwm14/detail/mapped_file.hpp"
+
 namespace hwm14::detail {
 
 namespace {
 
 template <typename T>
-bool ReadValue(std::ifstream& in, T& out) {
-  in.read(reinterpret_cast<char*>(&out), static_cast<std::streamsize>(sizeof(T)));
-  return static_cast<bool>(in);
+bool ReadValue(StreamCursor& in, T& out) {
+  return in.Read(out);
 }
 
 template <typename T>
-bool ReadArray(std::ifstream& in, T* out, std::size_t n) {
-  in.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(n * sizeof(T)));
-  return static_cast<bool>(in);
+bool ReadArray(StreamCursor& in, T* out, std::size_t n) {
+  return in.ReadArray(out, n);
 }
 
 }  // namespace
 
 Result<HwmBinHeader, Error> LoadHwmBinHeader(const std::filesystem::path& path) {
-  std::ifstream in(path, std::ios::binary);
-  if (!in.is_open()) {
-    return Result<HwmBinHeader, Error>::Err(
-        MakeError(ErrorCode::kDataFileOpenFailed, "failed to open hwm .bin file", path.string(), "LoadHwmBinHeader"));
+  const auto file = MappedFile::Open(path);
+  if (!file) {
+    const bool open_failed = file.error().code == ErrorCode::kDataFileOpenFailed;
+    return Result<HwmBinHeader, Error>::Err(MakeError(file.error().code,
+                                                      open_failed ? "failed to open hwm .bin file" : file.error().message,
+                                                      path.string(),
+                                                      "LoadHwmBinHeader"));
   }
+  return ParseHwmBinHeader(file.value()->bytes(), path.string());
+}
+
+Result<HwmBinHeader, Error> ParseHwmBinHeader(std::span<const std::byte> bytes, std::string_view source) {
+  const std::string path(source);
+  StreamCursor in(bytes);
 
   HwmBinHeader h;
   if (!ReadValue(in, h.nbf) || !ReadValue(in, h.maxs) || !ReadValue(in, h.maxm) || !ReadValue(in, h.maxl) ||
       !ReadValue(in, h.maxn) || !ReadValue(in, h.ncomp) || !ReadValue(in, h.nlev) || !ReadValue(in, h.p)) {
     return Result<HwmBinHeader, Error>::Err(MakeError(
-        ErrorCode::kDataFileParseFailed, "failed reading fixed-size header", path.string(), "LoadHwmBinHeader"));
+        ErrorCode::kDataFileParseFailed, "failed reading fixed-size header", path, "ParseHwmBinHeader"));
   }
 
   h.nnode = h.nlev + h.p;
   if (h.nnode < 0 || h.nnode > 10000) {
     return Result<HwmBinHeader, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "invalid nnode derived from header", path.string(), "LoadHwmBinHeader"));
+        MakeError(ErrorCode::kDataFileParseFailed, "invalid nnode derived from header", path, "ParseHwmBinHeader"));
   }
 
   h.vnode.resize(static_cast<std::size_t>(h.nnode + 1));
   if (!ReadArray(in, h.vnode.data(), h.vnode.size())) {
     return Result<HwmBinHeader, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "failed reading vnode array", path.string(), "LoadHwmBinHeader"));
+        MakeError(ErrorCode::kDataFileParseFailed, "failed reading vnode array", path, "ParseHwmBinHeader"));
   }
   if (h.vnode.size() > 3) {
     h.vnode[3] = 0.0;  // Fortran parity adjustment in initqwm.
@@ -62,14 +72,14 @@ Result<HwmBinHeader, Error> LoadHwmBinHeader(const std::filesystem::path& path)
   const std::int32_t last_level = h.nlev - h.p - 1;
   if (last_level < 0) {
     return Result<HwmBinHeader, Error>::Err(
-        MakeError(ErrorCode::kDataFileParseFailed, "invalid level span from nlev/p", path.string(), "LoadHwmBinHeader"));
+        MakeError(ErrorCode::kDataFileParseFailed, "invalid level span from nlev/p", path, "ParseHwmBinHeader"));
   }
 
   std::vector<std::int32_t> order_row(static_cast<std::size_t>(h.ncomp));
   for (std::int32_t i = 0; i <= last_level; ++i) {
     if (!ReadArray(in, order_row.data(), order_row.size())) {
       return Result<HwmBinHeader, Error>::Err(MakeError(
-          ErrorCode::kDataFileParseFailed, "failed reading order row", path.string(), "LoadHwmBinHeader"));
+          ErrorCode::kDataFileParseFailed, "failed reading order row", path, "ParseHwmBinHeader"));
     }
     for (std::int32_t c = 0; c < h.ncomp; ++c) {
       h.order[static_cast<std::size_t>(c) + static_cast<std::size_t>(h.ncomp) * static_cast<std::size_t>(i)] =
@@ -78,19 +88,19 @@ Result<HwmBinHeader, Error> LoadHwmBinHeader(const std::filesystem::path& path)
 
     if (!ReadValue(in, h.nb[static_cast<std::size_t>(i)])) {
       return Result<HwmBinHeader, Error>::Err(
-          MakeError(ErrorCode::kDataFileParseFailed, "failed reading nb entry", path.string(), "LoadHwmBinHeader"));
+          MakeError(ErrorCode::kDataFileParseFailed, "failed reading nb entry", path, "ParseHwmBinHeader"));
     }
 
     const std::size_t offset = static_cast<std::size_t>(h.nbf) * static_cast<std::size_t>(i);
     if (!ReadArray(in, h.mparm.data() + offset, static_cast<std::size_t>(h.nbf))) {
       return Result<HwmBinHeader, Error>::Err(MakeError(
-          ErrorCode::kDataFileParseFailed, "failed reading mparm column", path.string(), "LoadHwmBinHeader"));
+          ErrorCode::kDataFileParseFailed, "failed reading mparm column", path, "ParseHwmBinHeader"));
     }
   }
 
   if (!ReadArray(in, h.e1.data(), h.e1.size()) || !ReadArray(in, h.e2.data(), h.e2.size())) {
     return Result<HwmBinHeader, Error>::Err(MakeError(
-        ErrorCode::kDataFileParseFailed, "failed reading transition vectors", path.string(), "LoadHwmBinHeader"));
+        ErrorCode::kDataFileParseFailed, "failed reading transition vectors", path, "ParseHwmBinHeader"));
   }
 
   return Result<HwmBinHeader, Error>::Ok(std::move(h));
@@ -0,0 +1,81 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Implementation of read-only file mapping helpers.
+ */
+
+#include "hwm14/detail/mapped_file.hpp"
+
+#include <fstream>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HWM14_HAVE_MMAP 1
+#endif
+
+namespace hwm14::detail {
+
+MappedFile::~MappedFile() {
+#ifdef HWM14_HAVE_MMAP
+  if (mapped_ && data_ != nullptr) {
+    ::munmap(const_cast<std::byte*>(data_), size_);
+  }
+#endif
+}
+
+Result<std::shared_ptr<const MappedFile>, Error> MappedFile::Open(const std::filesystem::path& path) {
+  using R = Result<std::shared_ptr<const MappedFile>, Error>;
+  std::shared_ptr<MappedFile> out(new MappedFile());
+
+#ifdef HWM14_HAVE_MMAP
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return R::Err(MakeError(ErrorCode::kDataFileOpenFailed, "failed to open file for mapping", path.string(), "MappedFile::Open"));
+  }
+  struct stat st {};
+  if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+    ::close(fd);
+    return R::Err(MakeError(ErrorCode::kDataFileParseFailed, "file is empty or not stat-able", path.string(), "MappedFile::Open"));
+  }
+  const auto size = static_cast<std::size_t>(st.st_size);
+  void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    return R::Err(MakeError(ErrorCode::kDataFileOpenFailed, "mmap failed", path.string(), "MappedFile::Open"));
+  }
+  out->data_ = static_cast<const std::byte*>(addr);
+  out->size_ = size;
+  out->mapped_ = true;
+#else
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in.is_open()) {
+    return R::Err(MakeError(ErrorCode::kDataFileOpenFailed, "failed to open file", path.string(), "MappedFile::Open"));
+  }
+  const auto size = static_cast<std::size_t>(in.tellg());
+  if (size == 0) {
+    return R::Err(MakeError(ErrorCode::kDataFileParseFailed, "file is empty", path.string(), "MappedFile::Open"));
+  }
+  out->fallback_.resize(size);
+  in.seekg(0);
+  if (!in.read(reinterpret_cast<char*>(out->fallback_.data()), static_cast<std::streamsize>(size))) {
+    return R::Err(MakeError(ErrorCode::kDataFileParseFailed, "failed reading file", path.string(), "MappedFile::Open"));
+  }
+  out->data_ = out->fallback_.data();
+  out->size_ = size;
+#endif
+
+  return R::Ok(std::move(out));
+}
+
+std::shared_ptr<const MappedFile> MappedFile::AdoptMapping(const void* addr, std::size_t size) {
+  std::shared_ptr<MappedFile> out(new MappedFile());
+  out->data_ = static_cast<const std::byte*>(addr);
+  out->size_ = size;
+  out->mapped_ = true;
+  return out;
+}
+
+}  // namespace hwm14::detail
@@ -0,0 +1,524 @@
+/**
+ * @file model_blob.cpp
+ * @brief Implementation of the precompiled model blob writer and zero-copy reader.
+ */
+
+#include "hwm14/detail/model_blob.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace hwm14::detail {
+
+namespace {
+
+constexpr std::array<char, 8> kMagic = {'H', 'W', 'M', '1', '4', 'B', 'L', 'B'};
+constexpr std::uint32_t kEndianTag = 0x01020304U;
+
+enum class SectionId : std::uint32_t {
+  kDims = 1,
+  kFloats,
+  kVnode,
+  kNb,
+  kOrder,
+  kTransition,
+  kMparm,
+  kTparm,
+  kGd2qdCoeff,
+  kDwmTermarr,
+  kDwmCoeff,
+  kXcoeff,
+  kYcoeff,
+  kZcoeff,
+  kNormadj,
+  kAlfAnm,
+  kAlfBnm,
+  kAlfDnm,
+  kAlfCm,
+  kAlfEn,
+  kAlfMarr,
+  kAlfNarr,
+  kLoadedOrder,  // present only for truncated models: the order table before `WithTruncation`
+};
+
+// Slots of the int32 dimension section.
+enum DimSlot : std::size_t {
+  kNbf,
+  kMaxs,
+  kMaxm,
+  kMaxl,
+  kMaxn,
+  kNcomp,
+  kNlev,
+  kP,
+  kNnode,
+  kGdNmax,
+  kGdMmax,
+  kGdNterm,
+  kDwmNterm,
+  kDwmMmax,
+  kDwmNmax,
+  kMaxo,
+  kNmaxgeo,
+  kMmaxgeo,
+  kNvshterm,
+  kAlfNmax,
+  kAlfMmax,
+  kDimCount,
+};
+
+// Slots of the float32 scalar section (kept as float to round-trip exactly).
+enum FloatSlot : std::size_t {
+  kGdEpoch,
+  kGdAlt,
+  kDwmTwidth,
+  kFloatCount,
+};
+
+struct BlobHeader {
+  std::array<char, 8> magic{};
+  std::uint32_t version{};
+  std::uint32_t endian_tag{};
+  std::uint64_t total_size{};
+  std::uint64_t checksum{};
+  std::uint32_t section_count{};
+  std::uint32_t reserved0{};
+  std::array<std::uint64_t, 3> reserved{};
+};
+static_assert(sizeof(BlobHeader) == 64);
+static_assert(std::is_trivially_copyable_v<BlobHeader>);
+
+struct BlobSection {
+  std::uint32_t id{};
+  std::uint32_t elem_size{};
+  std::uint64_t offset{};
+  std::uint64_t count{};
+  std::uint64_t reserved{};
+};
+static_assert(sizeof(BlobSection) == 32);
+
+std::size_t AlignUp(std::size_t x) {
+  return (x + kModelBlobAlignment - 1) / kModelBlobAlignment * kModelBlobAlignment;
+}
+
+class BlobWriter {
+ public:
+  template <typename T>
+  void Add(SectionId id, std::span<const T> data) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    pending_.push_back(Pending{id, static_cast<std::uint32_t>(sizeof(T)), data.size(),
+                               reinterpret_cast<const std::byte*>(data.data())});
+  }
+
+  [[nodiscard]] std::vector<std::byte> Finish() const {
+    const std::size_t table_bytes = AlignUp(pending_.size() * sizeof(BlobSection));
+    std::size_t cursor = sizeof(BlobHeader) + table_bytes;
+
+    std::vector<BlobSection> table;
+    table.reserve(pending_.size());
+    for (const auto& p : pending_) {
+      BlobSection s{};
+      s.id = static_cast<std::uint32_t>(p.id);
+      s.elem_size = p.elem_size;
+      s.offset = cursor;
+      s.count = p.count;
+      table.push_back(s);
+      cursor = AlignUp(cursor + p.count * p.elem_size);
+    }
+
+    std::vector<std::byte> out(cursor, std::byte{0});
+    std::memcpy(out.data() + sizeof(BlobHeader), table.data(), table.size() * sizeof(BlobSection));
+    for (std::size_t i = 0; i < pending_.size(); ++i) {
+      if (pending_[i].count > 0) {
+        std::memcpy(out.data() + table[i].offset, pending_[i].data, pending_[i].count * pending_[i].elem_size);
+      }
+    }
+
+    BlobHeader h{};
+    h.magic = kMagic;
+    h.version = kModelBlobVersion;
+    h.endian_tag = kEndianTag;
+    h.total_size = out.size();
+    h.section_count = static_cast<std::uint32_t>(table.size());
+    h.checksum = BlobChecksum(std::span<const std::byte>(out).subspan(sizeof(BlobHeader)));
+    std::memcpy(out.data(), &h, sizeof(h));
+    return out;
+  }
+
+ private:
+  struct Pending {
+    SectionId id;
+    std::uint32_t elem_size;
+    std::size_t count;
+    const std::byte* data;
+  };
+  std::vector<Pending> pending_;
+};
+
+class BlobReader {
+ public:
+  BlobReader(std::span<const std::byte> bytes, std::span<const BlobSection> table, std::string_view where)
+      : bytes_(bytes), table_(table), where_(where) {}
+
+  // Returns a view of section `id`, which must hold exactly `count` elements of `T`.
+  template <typename T>
+  Result<std::span<const T>, Error> View(SectionId id, std::size_t count) const {
+    static_assert(std::is_trivially_copyable_v<T>);
+    for (const auto& s : table_) {
+      if (s.id != static_cast<std::uint32_t>(id)) {
+        continue;
+      }
+      if (s.elem_size != sizeof(T) || s.count != count || s.offset % alignof(T) != 0 ||
+          s.offset > bytes_.size() || s.count > (bytes_.size() - s.offset) / sizeof(T)) {
+        return Result<std::span<const T>, Error>::Err(Fail("blob section shape mismatch", id));
+      }
+      const auto* p = reinterpret_cast<const T*>(bytes_.data() + s.offset);
+      return Result<std::span<const T>, Error>::Ok(std::span<const T>(p, count));
+    }
+    return Result<std::span<const T>, Error>::Err(Fail("blob section missing", id));
+  }
+
+  [[nodiscard]] bool Has(SectionId id) const {
+    return std::any_of(table_.begin(), table_.end(),
+                       [id](const BlobSection& s) { return s.id == static_cast<std::uint32_t>(id); });
+  }
+
+  template <typename T>
+  bool Copy(SectionId id, std::size_t count, std::vector<T>& out, Error& err) const {
+    auto v = View<T>(id, count);
+    if (!v) {
+      err = v.error();
+      return false;
+    }
+    out.assign(v.value().begin(), v.value().end());
+    return true;
+  }
+
+  [[nodiscard]] Error Fail(std::string message, SectionId id) const {
+    return MakeError(ErrorCode::kDataFileParseFailed, std::move(message),
+                     "section " + std::to_string(static_cast<std::uint32_t>(id)), std::string(where_));
+  }
+
+ private:
+  std::span<const std::byte> bytes_;
+  std::span<const BlobSection> table_;
+  std::string_view where_;
+};
+
+std::size_t Count(int n) {
+  return n < 0 ? 0U : static_cast<std::size_t>(n);
+}
+
+// Terms of a QD expansion of degree `nmax` and order `mmax`, in `Gd2qdSums` order.
+std::int64_t Gd2qdTermCount(int nmax, int mmax) {
+  std::int64_t terms = nmax + 1;
+  for (int m = 1; m <= mmax; ++m) {
+    terms += 2LL * std::max(0, nmax - m + 1);
+  }
+  return terms;
+}
+
+// Whether level `d`'s order entries stay inside the harmonic tables and the wave/tide factors (orders up
+// to 3), and its basis row, counted as `FillQuietLevelBasis` writes it, fits in `nbf` columns.
+bool QuietLevelOrderValid(const HwmBinHeader& h, int d) {
+  const auto entry = [&](int k) { return h.order[HwmOrderIdx(k, d, h.ncomp)]; };
+  const int amaxs = entry(0);
+  const int amaxn = entry(1);
+  const int pmaxm = entry(2);
+  const int pmaxs = entry(3);
+  const int pmaxn = entry(4);
+  const int tmaxl = entry(5);
+  const int tmaxs = entry(6);
+  const int tmaxn = entry(7);
+  const std::array<std::array<int, 2>, 8> bounds = {{{amaxs, h.maxs},
+                                                     {amaxn, h.maxn},
+                                                     {pmaxm, std::min(h.maxm, 3)},
+                                                     {pmaxs, h.maxs},
+                                                     {pmaxn, h.maxn},
+                                                     {tmaxl, std::min(h.maxl, 3)},
+                                                     {tmaxs, h.maxs},
+                                                     {tmaxn, h.maxn}}};
+  for (const auto& [value, limit] : bounds) {
+    if (value < 0 || value > limit) {
+      return false;
+    }
+  }
+
+  std::int64_t terms = 2LL * amaxn * (1 + 2LL * amaxs);
+  for (int m = 1; m <= pmaxm; ++m) {
+    terms += std::max(0, pmaxn - m + 1) * (4LL + 8LL * pmaxs);
+  }
+  for (int l = 1; l <= tmaxl; ++l) {
+    terms += std::max(0, tmaxn - l + 1) * (4LL + 8LL * tmaxs);
+  }
+  return terms <= h.nbf;
+}
+
+}  // namespace
+
+std::uint64_t BlobChecksum(std::span<const std::byte> bytes) {
+  std::uint64_t h = 0xcbf29ce484222325ULL;
+  const std::size_t words = bytes.size() / sizeof(std::uint64_t);
+  for (std::size_t i = 0; i < words; ++i) {
+    std::uint64_t w = 0;
+    std::memcpy(&w, bytes.data() + i * sizeof(std::uint64_t), sizeof(w));
+    h = (h ^ w) * 0x100000001b3ULL;
+  }
+  for (std::size_t i = words * sizeof(std::uint64_t); i < bytes.size(); ++i) {
+    h = (h ^ static_cast<std::uint64_t>(bytes[i])) * 0x100000001b3ULL;
+  }
+  return h;
+}
+
+Result<std::vector<std::byte>, Error> SerializeModelBlob(const Model::Impl& impl) {
+  if (impl.ensemble_members != 0) {
+    return Result<std::vector<std::byte>, Error>::Err(MakeError(
+        ErrorCode::kInvalidInput, "blobs do not carry ensemble members", {}, "SerializeModelBlob"));
+  }
+  if (impl.altitude_band) {
+    return Result<std::vector<std::byte>, Error>::Err(MakeError(
+        ErrorCode::kInvalidInput, "blobs do not carry altitude-banded models", {}, "SerializeModelBlob"));
+  }
+  const auto resolved = ResolveDisturbance(impl, "SerializeModelBlob");
+  if (!resolved) {
+    return Result<std::vector<std::byte>, Error>::Err(resolved.error());
+  }
+  const DisturbanceTables& dist = *resolved.value();
+
+  const auto& h = impl.hwm;
+  std::array<std::int32_t, kDimCount> dims{};
+  dims[kNbf] = h.nbf;
+  dims[kMaxs] = h.maxs;
+  dims[kMaxm] = h.maxm;
+  dims[kMaxl] = h.maxl;
+  dims[kMaxn] = h.maxn;
+  dims[kNcomp] = h.ncomp;
+  dims[kNlev] = h.nlev;
+  dims[kP] = h.p;
+  dims[kNnode] = h.nnode;
+  dims[kGdNmax] = dist.gd2qd.nmax;
+  dims[kGdMmax] = dist.gd2qd.mmax;
+  dims[kGdNterm] = dist.gd2qd.nterm;
+  dims[kDwmNterm] = dist.dwm.nterm;
+  dims[kDwmMmax] = dist.dwm.mmax;
+  dims[kDwmNmax] = dist.dwm.nmax;
+  dims[kMaxo] = impl.maxo;
+  dims[kNmaxgeo] = dist.nmaxgeo;
+  dims[kMmaxgeo] = dist.mmaxgeo;
+  dims[kNvshterm] = dist.nvshterm;
+  dims[kAlfNmax] = dist.alf.nmax0;
+  dims[kAlfMmax] = dist.alf.mmax0;
+
+  std::array<float, kFloatCount> floats{};
+  floats[kGdEpoch] = dist.gd2qd.epoch;
+  floats[kGdAlt] = dist.gd2qd.alt;
+  floats[kDwmTwidth] = dist.dwm.twidth;
+
+  std::array<double, 10> transition{};
+  std::copy(h.e1.begin(), h.e1.end(), transition.begin());
+  std::copy(h.e2.begin(), h.e2.end(), transition.begin() + 5);
+
+  BlobWriter w;
+  w.Add<std::int32_t>(SectionId::kDims, dims);
+  w.Add<float>(SectionId::kFloats, floats);
+  w.Add<double>(SectionId::kVnode, h.vnode);
+  w.Add<std::int32_t>(SectionId::kNb, h.nb);
+  w.Add<std::int32_t>(SectionId::kOrder, h.order);
+  w.Add<double>(SectionId::kTransition, transition);
+  w.Add<double>(SectionId::kMparm, impl.mparm);
+  w.Add<double>(SectionId::kTparm, impl.tparm);
+  w.Add<double>(SectionId::kGd2qdCoeff, dist.gd2qd.coeff_flat);
+  w.Add<std::int32_t>(SectionId::kDwmTermarr, dist.dwm.termarr_flat);
+  w.Add<float>(SectionId::kDwmCoeff, dist.dwm.coeff);
+  w.Add<double>(SectionId::kXcoeff, dist.xcoeff);
+  w.Add<double>(SectionId::kYcoeff, dist.ycoeff);
+  w.Add<double>(SectionId::kZcoeff, dist.zcoeff);
+  w.Add<double>(SectionId::kNormadj, dist.normadj);
+  w.Add<double>(SectionId::kAlfAnm, dist.alf.anm);
+  w.Add<double>(SectionId::kAlfBnm, dist.alf.bnm);
+  w.Add<double>(SectionId::kAlfDnm, dist.alf.dnm);
+  w.Add<double>(SectionId::kAlfCm, dist.alf.cm);
+  w.Add<double>(SectionId::kAlfEn, dist.alf.en);
+  w.Add<double>(SectionId::kAlfMarr, dist.alf.marr);
+  w.Add<double>(SectionId::kAlfNarr, dist.alf.narr);
+  if (!impl.loaded_order.empty()) {
+    w.Add<std::int32_t>(SectionId::kLoadedOrder, impl.loaded_order);
+  }
+  return Result<std::vector<std::byte>, Error>::Ok(w.Finish());
+}
+
+Result<std::shared_ptr<Model::Impl>, Error> ModelImplFromBlob(std::span<const std::byte> bytes,
+                                                              std::shared_ptr<const void> owner,
+                                                              bool verify_checksum,
+                                                              std::string_view where) {
+  using R = Result<std::shared_ptr<Model::Impl>, Error>;
+  auto fail = [&](std::string message, std::string detail = {}) {
+    return R::Err(MakeError(ErrorCode::kDataFileParseFailed, std::move(message), std::move(detail), std::string(where)));
+  };
+
+  if (reinterpret_cast<std::uintptr_t>(bytes.data()) % alignof(double) != 0) {
+    return fail("blob base address is not aligned");
+  }
+  if (bytes.size() < sizeof(BlobHeader)) {
+    return fail("blob too small for header", std::to_string(bytes.size()));
+  }
+
+  BlobHeader header{};
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  if (header.magic != kMagic) {
+    return fail("blob magic mismatch");
+  }
+  if (header.endian_tag != kEndianTag) {
+    return fail("blob byte order does not match host");
+  }
+  if (header.version != kModelBlobVersion) {
+    return fail("unsupported blob version", std::to_string(header.version));
+  }
+  if (header.total_size < sizeof(BlobHeader) || header.total_size > bytes.size()) {
+    return fail("blob truncated", std::to_string(bytes.size()));
+  }
+  bytes = bytes.first(static_cast<std::size_t>(header.total_size));
+  if (header.section_count > (bytes.size() - sizeof(BlobHeader)) / sizeof(BlobSection)) {
+    return fail("blob section table out of range");
+  }
+  if (verify_checksum && BlobChecksum(bytes.subspan(sizeof(BlobHeader))) != header.checksum) {
+    return fail("blob checksum mismatch");
+  }
+
+  const auto* table_ptr = reinterpret_cast<const BlobSection*>(bytes.data() + sizeof(BlobHeader));
+  const BlobReader r(bytes, std::span<const BlobSection>(table_ptr, header.section_count), where);
+
+  const auto dims_v = r.View<std::int32_t>(SectionId::kDims, kDimCount);
+  const auto floats_v = r.View<float>(SectionId::kFloats, kFloatCount);
+  if (!dims_v) {
+    return R::Err(dims_v.error());
+  }
+  if (!floats_v) {
+    return R::Err(floats_v.error());
+  }
+  const auto dims = dims_v.value();
+  for (const auto d : dims) {
+    if (d < 0 || d > 1000000) {
+      return fail("blob dimension out of range", std::to_string(d));
+    }
+  }
+
+  auto impl = std::make_shared<Model::Impl>();
+  auto dist = std::make_shared<DisturbanceTables>();
+  auto& h = impl->hwm;
+  h.nbf = dims[kNbf];
+  h.maxs = dims[kMaxs];
+  h.maxm = dims[kMaxm];
+  h.maxl = dims[kMaxl];
+  h.maxn = dims[kMaxn];
+  h.ncomp = dims[kNcomp];
+  h.nlev = dims[kNlev];
+  h.p = dims[kP];
+  h.nnode = dims[kNnode];
+  dist->gd2qd.nmax = dims[kGdNmax];
+  dist->gd2qd.mmax = dims[kGdMmax];
+  dist->gd2qd.nterm = dims[kGdNterm];
+  dist->gd2qd.epoch = floats_v.value()[kGdEpoch];
+  dist->gd2qd.alt = floats_v.value()[kGdAlt];
+  dist->dwm.nterm = dims[kDwmNterm];
+  dist->dwm.mmax = dims[kDwmMmax];
+  dist->dwm.nmax = dims[kDwmNmax];
+  dist->dwm.twidth = floats_v.value()[kDwmTwidth];
+  impl->maxo = dims[kMaxo];
+  dist->nmaxgeo = dims[kNmaxgeo];
+  dist->mmaxgeo = dims[kMmaxgeo];
+  dist->nvshterm = dims[kNvshterm];
+  dist->alf.nmax0 = dims[kAlfNmax];
+  dist->alf.mmax0 = dims[kAlfMmax];
+
+  // Structural bounds the evaluators index by without further checks. They are cheap, so they run even
+  // when `verify_checksum` is off and a damaged blob would otherwise be trusted.
+  if (h.nnode != h.nlev + h.p || h.nlev - h.p - 1 < 0 || h.ncomp < 8 ||
+      impl->maxo != std::max({h.maxs, h.maxm, h.maxl})) {
+    return fail("blob quiet dimensions inconsistent");
+  }
+  if (dist->gd2qd.nterm != Gd2qdTermCount(dist->gd2qd.nmax, dist->gd2qd.mmax)) {
+    return fail("blob QD term count does not match its degree and order", std::to_string(dist->gd2qd.nterm));
+  }
+
+  const std::size_t nnode1 = Count(h.nnode + 1);
+  const std::size_t ncoef = Count(h.nbf) * Count(h.nlev + 1);
+  const std::size_t alf_nm = Count(dist->alf.nmax0 + 1) * Count(dist->alf.mmax0 + 1);
+  const std::size_t gd_nterm = Count(dist->gd2qd.nterm);
+
+  Error err{};
+  std::vector<double> transition;
+  if (!r.Copy(SectionId::kVnode, nnode1, h.vnode, err) || !r.Copy(SectionId::kNb, nnode1, h.nb, err) ||
+      !r.Copy(SectionId::kOrder, Count(h.ncomp) * nnode1, h.order, err) ||
+      !r.Copy(SectionId::kTransition, 10, transition, err) ||
+      !r.Copy(SectionId::kGd2qdCoeff, gd_nterm * 3U, dist->gd2qd.coeff_flat, err) ||
+      !r.Copy(SectionId::kDwmTermarr, Count(dist->dwm.nterm) * 3U, dist->dwm.termarr_flat, err) ||
+      !r.Copy(SectionId::kDwmCoeff, Count(dist->dwm.nterm), dist->dwm.coeff, err) ||
+      !r.Copy(SectionId::kXcoeff, gd_nterm, dist->xcoeff, err) ||
+      !r.Copy(SectionId::kYcoeff, gd_nterm, dist->ycoeff, err) ||
+      !r.Copy(SectionId::kZcoeff, gd_nterm, dist->zcoeff, err) ||
+      !r.Copy(SectionId::kNormadj, Count(dist->gd2qd.nmax + 1), dist->normadj, err) ||
+      !r.Copy(SectionId::kAlfAnm, alf_nm, dist->alf.anm, err) ||
+      !r.Copy(SectionId::kAlfBnm, alf_nm, dist->alf.bnm, err) ||
+      !r.Copy(SectionId::kAlfDnm, alf_nm, dist->alf.dnm, err) ||
+      !r.Copy(SectionId::kAlfCm, Count(dist->alf.mmax0 + 1), dist->alf.cm, err) ||
+      !r.Copy(SectionId::kAlfEn, Count(dist->alf.nmax0 + 1), dist->alf.en, err) ||
+      !r.Copy(SectionId::kAlfMarr, Count(dist->alf.mmax0 + 1), dist->alf.marr, err) ||
+      !r.Copy(SectionId::kAlfNarr, Count(dist->alf.nmax0 + 1), dist->alf.narr, err)) {
+    return R::Err(std::move(err));
+  }
+  for (int d = 0; d <= h.nnode; ++d) {
+    if (!QuietLevelOrderValid(h, d)) {
+      return fail("blob order table out of range", "level " + std::to_string(d));
+    }
+  }
+  if (r.Has(SectionId::kLoadedOrder)) {
+    if (!r.Copy(SectionId::kLoadedOrder, Count(h.ncomp) * nnode1, impl->loaded_order, err)) {
+      return R::Err(std::move(err));
+    }
+    // Only the parity split and remap of raw ensemble members read it, so its columns must fit `nbf`
+    // but its orders may exceed the truncated harmonic dimensions.
+    HwmBinHeader loaded = h;
+    loaded.order = impl->loaded_order;
+    loaded.maxs = loaded.maxm = loaded.maxl = loaded.maxn = h.nbf;
+    for (int d = 0; d <= h.nnode; ++d) {
+      if (!QuietLevelOrderValid(loaded, d)) {
+        return fail("blob loaded order table out of range", "level " + std::to_string(d));
+      }
+    }
+  }
+  std::copy_n(transition.begin(), 5, h.e1.begin());
+  std::copy_n(transition.begin() + 5, 5, h.e2.begin());
+
+  const auto mparm = r.View<double>(SectionId::kMparm, ncoef);
+  if (!mparm) {
+    return R::Err(mparm.error());
+  }
+  const auto tparm = r.View<double>(SectionId::kTparm, ncoef);
+  if (!tparm) {
+    return R::Err(tparm.error());
+  }
+  impl->mparm = mparm.value();
+  impl->tparm = tparm.value();
+  impl->coeff_storage = std::move(owner);
+
+  if (dist->alf.nmax0 < std::max({dist->nmaxgeo, dist->dwm.nmax, h.maxn, dist->gd2qd.nmax}) ||
+      dist->alf.mmax0 < std::max({dist->mmaxgeo, dist->dwm.mmax, impl->maxo, dist->gd2qd.mmax})) {
+    return fail("blob ALF tables smaller than model dimensions");
+  }
+  // The stored ALF tables cover the quiet dimensions as well; entries do not depend on the table size.
+  impl->alf = dist->alf;
+  BindFixedAlfKernels(*impl);
+  BindFixedAlfKernels(*dist);
+  if (!CompileDwmTermProgram(*dist)) {
+    return fail("blob DWM term indices out of range");
+  }
+  impl->disturbance = std::move(dist);
+  BindQuietLevelKernels(*impl);
+  return R::Ok(std::move(impl));
+}
+
+}  // namespace hwm14::detail
@@ -0,0 +1,81 @@
+/**
+ * @file model_handle.cpp
+ * @brief Implementation of the atomically swappable model handle.
+ */
+
+#include "hwm14/model_handle.hpp"
+
+#include <utility>
+
+// libstdc++ 12's `std::atomic<std::shared_ptr>` releases its internal spinlock with relaxed ordering
+// on loads, which ThreadSanitizer reports as a race; sanitized builds use the mutex-pool free functions.
+#if defined(__SANITIZE_THREAD__)
+#define HWM14_ATOMIC_SHARED_PTR 0
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define HWM14_ATOMIC_SHARED_PTR 0
+#endif
+#endif
+#ifndef HWM14_ATOMIC_SHARED_PTR
+#ifdef __cpp_lib_atomic_shared_ptr
+#define HWM14_ATOMIC_SHARED_PTR 1
+#else
+#define HWM14_ATOMIC_SHARED_PTR 0
+#endif
+#endif
+
+namespace hwm14 {
+
+struct ModelHandle::Current {
+#if HWM14_ATOMIC_SHARED_PTR
+  std::atomic<std::shared_ptr<const Model>> model;
+
+  std::shared_ptr<const Model> Load() const { return model.load(std::memory_order_acquire); }
+  void Store(std::shared_ptr<const Model> next) { model.store(std::move(next), std::memory_order_release); }
+#else
+  std::shared_ptr<const Model> model;  // accessed only through std::atomic_load / std::atomic_store
+
+  std::shared_ptr<const Model> Load() const { return std::atomic_load_explicit(&model, std::memory_order_acquire); }
+  void Store(std::shared_ptr<const Model> next) {
+    std::atomic_store_explicit(&model, std::move(next), std::memory_order_release);
+  }
+#endif
+};
+
+ModelHandle::ModelHandle(Model initial, Options reload_options)
+    : current_(std::make_unique<Current>()), reload_options_(std::move(reload_options)) {
+  current_->Store(std::make_shared<const Model>(std::move(initial)));
+}
+
+ModelHandle::~ModelHandle() = default;
+
+std::shared_ptr<const Model> ModelHandle::Snapshot() const {
+  return current_->Load();
+}
+
+std::uint64_t ModelHandle::Generation() const {
+  return generation_.load(std::memory_order_acquire);
+}
+
+std::uint64_t ModelHandle::Publish(Model model) {
+  auto next = std::make_shared<const Model>(std::move(model));
+  std::lock_guard<std::mutex> lock(publish_mutex_);
+  current_->Store(std::move(next));
+  return generation_.fetch_add(1, std::memory_order_acq_rel) + 1;
+}
+
+Result<std::uint64_t, Error> ModelHandle::Reload(const std::filesystem::path& data_dir) {
+  // Load without holding the publish lock: readers never wait on it, and a slow load does not block
+  // a concurrent `Publish` of an already built model.
+  auto loaded = Model::LoadFromDirectory(data_dir, reload_options_);
+  if (!loaded) {
+    return Result<std::uint64_t, Error>::Err(loaded.error());
+  }
+  return Result<std::uint64_t, Error>::Ok(Publish(std::move(loaded.value())));
+}
+
+std::future<Result<std::uint64_t, Error>> ModelHandle::ReloadAsync(std::filesystem::path data_dir) {
+  return std::async(std::launch::async, [this, dir = std::move(data_dir)] { return Reload(dir); });
+}
+
+}  // namespace hwm14
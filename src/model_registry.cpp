@@ -0,0 +1,141 @@
+/**
+ * @file model_registry.cpp
+ * @brief Process-wide interned cache of derived model state keyed on data file identity.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "hwm14/detail/model_impl.hpp"
+#include "hwm14/hwm14.hpp"
+
+namespace hwm14 {
+
+namespace {
+
+struct InternKey {
+  DataPathsIdentity files{};
+  bool quiet_only{};
+  bool lazy_disturbance{};
+  std::optional<AltitudeBand> altitude_band{};
+  bool single_precision{};
+  bool strict_fp{};
+  double qd_grid_step_deg{};
+
+  bool operator==(const InternKey& o) const {
+    const auto same_band = [](const std::optional<AltitudeBand>& a, const std::optional<AltitudeBand>& b) {
+      return a.has_value() == b.has_value() && (!a || (a->min_km == b->min_km && a->max_km == b->max_km));
+    };
+    return files == o.files && quiet_only == o.quiet_only && lazy_disturbance == o.lazy_disturbance &&
+           same_band(altitude_band, o.altitude_band) && single_precision == o.single_precision &&
+           strict_fp == o.strict_fp && qd_grid_step_deg == o.qd_grid_step_deg;
+  }
+};
+
+struct InternEntry {
+  InternKey key;
+  std::shared_ptr<const Model::Impl> impl;
+};
+
+// Linear scan is fine: a process holds a handful of data sets at most.
+struct InternRegistry {
+  std::mutex mutex;
+  std::vector<InternEntry> entries;
+};
+
+InternRegistry& Registry() {
+  static InternRegistry registry;
+  return registry;
+}
+
+InternKey MakeKey(DataPathsIdentity files, const Options& options) {
+  return InternKey{std::move(files), options.quiet_only, options.lazy_disturbance, options.altitude_band,
+                   options.single_precision, options.strict_fp, options.qd_grid_step_deg};
+}
+
+// Same file paths and options, but at least one file has since changed on disk.
+bool IsStale(const InternKey& cached, const InternKey& current) {
+  const auto& c = cached.files;
+  const auto& n = current.files;
+  const bool same_paths = c.hwm_bin.canonical == n.hwm_bin.canonical && c.dwm_dat.canonical == n.dwm_dat.canonical &&
+                          c.gd2qd_dat.canonical == n.gd2qd_dat.canonical;
+  auto relabeled = cached;
+  relabeled.files = current.files;
+  return same_paths && relabeled == current && !(c == n);
+}
+
+}  // namespace
+
+Result<Model, Error> Model::LoadInterned(std::filesystem::path data_dir, Options options) {
+  options.data_dir = std::move(data_dir);
+  auto paths = ResolveDataPathsFromDirectory(options.data_dir);
+  if (!paths) {
+    return Result<Model, Error>::Err(paths.error());
+  }
+  auto files = IdentifyDataFiles(paths.value());
+  if (!files) {
+    return Result<Model, Error>::Err(files.error());
+  }
+  auto key = MakeKey(std::move(files.value()), options);
+
+  auto& registry = Registry();
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto& e : registry.entries) {
+      if (e.key == key) {
+        return Result<Model, Error>::Ok(Model(e.impl, std::move(options)));
+      }
+    }
+  }
+
+  // Parse outside the lock so unrelated data sets load concurrently; if two threads race on the same
+  // key, the first insert wins and both return its state.
+  auto loaded = LoadFromResolvedPaths(std::move(paths.value()), options);
+  if (!loaded) {
+    return loaded;
+  }
+  if (const auto& lazy = loaded.value().impl_->lazy_disturbance) {
+    // The disturbance files are read on first use, which may be long after they were keyed here.
+    lazy->interned_files = key.files;
+  }
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto& e : registry.entries) {
+    if (e.key == key) {
+      return Result<Model, Error>::Ok(Model(e.impl, std::move(options)));
+    }
+  }
+  std::erase_if(registry.entries, [&key](const InternEntry& e) { return IsStale(e.key, key); });
+  registry.entries.push_back(InternEntry{std::move(key), loaded.value().impl_});
+  return loaded;
+}
+
+std::size_t Model::EvictInterned(const std::filesystem::path& data_dir) {
+  auto& registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  if (data_dir.empty()) {
+    const std::size_t n = registry.entries.size();
+    registry.entries.clear();
+    return n;
+  }
+  std::error_code ec;
+  auto dir = std::filesystem::canonical(data_dir, ec);
+  if (ec) {
+    dir = std::filesystem::absolute(data_dir, ec).lexically_normal();
+  }
+  return std::erase_if(registry.entries,
+                       [&dir](const InternEntry& e) { return e.key.files.hwm_bin.canonical.parent_path() == dir; });
+}
+
+std::size_t Model::InternedCount() {
+  auto& registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.entries.size();
+}
+
+}  // namespace hwm14
@@ -0,0 +1,18 @@
+/**
+ * @file quiet_level_kernels.cpp
+ * @brief Binding of build-time generated quiet-wind level kernels.
+ */
+
+#include "hwm14/detail/model_impl.hpp"
+
+namespace hwm14::detail {
+
+void BindQuietLevelKernels(Model::Impl& impl) {
+#ifdef HWM14_GENERATED_QUIET_KERNELS
+  impl.quiet_levels = GeneratedQuietLevelKernels(impl.hwm);
+#else
+  impl.quiet_levels = {};
+#endif
+}
+
+}  // namespace hwm14::detail
@@ -0,0 +1,252 @@
+/**
+ * @file quiet_surrogate.cpp
+ * @brief Construction and tensor-product interpolation of quiet-wind surrogate lattices.
+ */
+
+#include "hwm14/quiet_surrogate.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "hwm14/detail/cubic_weights.hpp"
+#include "hwm14/detail/time_utils.hpp"
+
+namespace hwm14 {
+namespace {
+
+constexpr std::size_t kMaxLatticeNodes = std::size_t{1} << 26;  // 1 GiB of `Winds`
+
+// Node count of a closed range sampled every `step`, or 0 if `step` does not divide the range.
+int ClosedAxisCount(double lo, double hi, double step) {
+  const double cells = (hi - lo) / step;
+  if (!std::isfinite(cells) || cells < 1.0 || std::abs(cells - std::round(cells)) > 1e-9 * cells) {
+    return 0;
+  }
+  return static_cast<int>(std::lround(cells)) + 1;
+}
+
+// Node count of a periodic axis, or 0 if `step` does not divide the period into at least two cells.
+int PeriodicAxisCount(double period, double step) {
+  const double cells = period / step;
+  if (!std::isfinite(cells) || cells < 2.0 || std::abs(cells - std::round(cells)) > 1e-9 * cells) {
+    return 0;
+  }
+  return static_cast<int>(std::lround(cells));
+}
+
+// `x` reduced to [0, period); floor-based because `fmod` dominates the interpolation cost.
+double Wrap(double x, double period) {
+  const double r = x - period * std::floor(x / period);
+  return (r >= 0.0 && r < period) ? r : 0.0;
+}
+
+}  // namespace
+
+QuietSurrogate::QuietSurrogate(Model model, QuietSurrogateSpec spec, std::array<Axis, 4> axes)
+    : model_(std::move(model)), spec_(spec), axes_(axes) {}
+
+Result<QuietSurrogate, Error> QuietSurrogate::Build(Model model, const QuietSurrogateSpec& spec) {
+  using R = Result<QuietSurrogate, Error>;
+  const auto invalid = [](std::string message, std::string detail = {}) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput, std::move(message), std::move(detail), "QuietSurrogate::Build"));
+  };
+  if (!detail::DecodeYyddd(spec.yyddd)) {
+    return invalid("yyddd is not a valid YYDDD date", std::to_string(spec.yyddd));
+  }
+  if (!(spec.lat_min_deg >= -90.0 && spec.lat_max_deg <= 90.0 && spec.lat_min_deg < spec.lat_max_deg)) {
+    return invalid("latitude range must satisfy -90 <= lat_min_deg < lat_max_deg <= 90");
+  }
+  if (!(spec.alt_min_km >= 0.0 && spec.alt_max_km <= 5000.0 && spec.alt_min_km < spec.alt_max_km)) {
+    return invalid("altitude range must satisfy 0 <= alt_min_km < alt_max_km <= 5000");
+  }
+
+  const bool lon_axis = spec.axis == SurrogateAxis::kLongitude;
+  std::array<Axis, 4> axes{};
+  axes[0] = {0.0, spec.ut_step_h, PeriodicAxisCount(24.0, spec.ut_step_h), true};
+  axes[1] = {spec.alt_min_km, spec.alt_step_km, ClosedAxisCount(spec.alt_min_km, spec.alt_max_km, spec.alt_step_km), false};
+  axes[2] = {spec.lat_min_deg, spec.lat_step_deg, ClosedAxisCount(spec.lat_min_deg, spec.lat_max_deg, spec.lat_step_deg),
+             false};
+  axes[3] = {lon_axis ? -180.0 : 0.0, spec.axis_step, PeriodicAxisCount(lon_axis ? 360.0 : 24.0, spec.axis_step), true};
+  std::size_t nodes = 1;
+  for (const auto& axis : axes) {
+    if (axis.count == 0) {
+      return invalid("lattice steps must divide their ranges (periodic axes into at least two cells)");
+    }
+    nodes *= static_cast<std::size_t>(axis.count);
+    if (nodes > kMaxLatticeNodes) {
+      return invalid("lattice too large", std::to_string(nodes) + "+ nodes");
+    }
+  }
+
+  auto lattice = std::make_shared<std::vector<Winds>>(nodes);
+  Inputs in{};
+  in.yyddd = spec.yyddd;
+  std::size_t k = 0;
+  for (int iu = 0; iu < axes[0].count; ++iu) {
+    const double ut_h = axes[0].step * iu;
+    in.ut_seconds = ut_h * 3600.0;
+    for (int ia = 0; ia < axes[1].count; ++ia) {
+      in.altitude_km = std::min(axes[1].origin + axes[1].step * ia, spec.alt_max_km);
+      for (int il = 0; il < axes[2].count; ++il) {
+        in.geodetic_lat_deg = std::min(axes[2].origin + axes[2].step * il, spec.lat_max_deg);
+        for (int ix = 0; ix < axes[3].count; ++ix) {
+          const double x = axes[3].origin + axes[3].step * ix;
+          in.geodetic_lon_deg = lon_axis ? x : Wrap((x - ut_h) * 15.0 + 180.0, 360.0) - 180.0;
+          const auto w = model.QuietWinds(in);
+          if (!w) {
+            return R::Err(w.error());
+          }
+          (*lattice)[k++] = w.value();
+        }
+      }
+    }
+  }
+
+  QuietSurrogate surrogate(std::move(model), spec, axes);
+  surrogate.lattice_ = std::move(lattice);
+  if (spec.validation_points > 0) {
+    surrogate.report_ = surrogate.Validate(spec.validation_points, spec.validation_seed);
+  }
+  return R::Ok(std::move(surrogate));
+}
+
+WindsDifference QuietSurrogate::Validate(std::size_t samples, std::uint64_t seed) const {
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> lat(spec_.lat_min_deg, spec_.lat_max_deg);
+  std::uniform_real_distribution<double> lon(-180.0, 180.0);
+  std::uniform_real_distribution<double> alt(spec_.alt_min_km, spec_.alt_max_km);
+  std::uniform_real_distribution<double> ut(0.0, 86400.0);
+
+  WindsDifference report{};
+  double sum_sq = 0.0;
+  Inputs in{};
+  in.yyddd = spec_.yyddd;
+  for (std::size_t i = 0; i < samples; ++i) {
+    in.geodetic_lat_deg = lat(rng);
+    in.geodetic_lon_deg = lon(rng);
+    in.altitude_km = alt(rng);
+    in.ut_seconds = ut(rng);
+    const auto exact = model_.QuietWinds(in);
+    if (!exact) {
+      continue;
+    }
+    const Winds approx = Interpolate(in);
+    const double err = std::hypot(approx.zonal_mps - exact.value().zonal_mps,
+                                  approx.meridional_mps - exact.value().meridional_mps);
+    sum_sq += err * err;
+    report.max_mps = std::max(report.max_mps, err);
+    ++report.samples;
+  }
+  report.rms_mps = report.samples > 0 ? std::sqrt(sum_sq / static_cast<double>(report.samples)) : 0.0;
+  return report;
+}
+
+std::size_t QuietSurrogate::LatticeBytes() const {
+  return lattice_->size() * sizeof(Winds);
+}
+
+bool QuietSurrogate::Covers(const Inputs& in) const {
+  // `spec_.yyddd` passed `DecodeYyddd`, so a non-negative code with the same day of year is valid too.
+  return in.yyddd >= 0 && in.yyddd % 1000 == spec_.yyddd % 1000 && std::isfinite(in.ut_seconds) &&
+         std::isfinite(in.geodetic_lon_deg) && std::isfinite(in.ap3) && in.geodetic_lat_deg >= spec_.lat_min_deg &&
+         in.geodetic_lat_deg <= spec_.lat_max_deg && in.altitude_km >= spec_.alt_min_km &&
+         in.altitude_km <= spec_.alt_max_km;
+}
+
+Result<Winds, Error> QuietSurrogate::QuietWinds(const Inputs& in) const {
+  if (!Covers(in)) {
+    return model_.QuietWinds(in);
+  }
+  return Result<Winds, Error>::Ok(Interpolate(in));
+}
+
+Result<std::size_t, Error> QuietSurrogate::QuietWindsBatch(std::span<const Inputs> in, std::span<Winds> out) const {
+  using R = Result<std::size_t, Error>;
+  if (out.size() < in.size()) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput, "output buffer smaller than the input batch",
+                            std::to_string(out.size()), "QuietSurrogate::QuietWindsBatch"));
+  }
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    if (Covers(in[i])) {
+      out[i] = Interpolate(in[i]);
+      continue;
+    }
+    auto w = model_.QuietWinds(in[i]);
+    if (!w) {
+      auto err = w.error();
+      err.detail = "row " + std::to_string(i);
+      return R::Err(std::move(err));
+    }
+    out[i] = w.value();
+  }
+  return R::Ok(in.size());
+}
+
+Winds QuietSurrogate::Interpolate(const Inputs& in) const {
+  const double ut_h = Wrap(in.ut_seconds / 3600.0, 24.0);
+  const double x = spec_.axis == SurrogateAxis::kLongitude
+                       ? Wrap(in.geodetic_lon_deg + 180.0, 360.0)
+                       : Wrap(ut_h + in.geodetic_lon_deg / 15.0, 24.0);
+  const std::array<double, 4> coords = {ut_h / axes_[0].step, (in.altitude_km - axes_[1].origin) / axes_[1].step,
+                                        (in.geodetic_lat_deg - axes_[2].origin) / axes_[2].step, x / axes_[3].step};
+  if (spec_.interpolation == SurrogateInterpolation::kCubic) {
+    return InterpolateTaps<4>(coords);
+  }
+  return InterpolateTaps<2>(coords);
+}
+
+// `K` lattice values per axis (2: linear, 4: Catmull-Rom). Periodic axes wrap; closed axes clamp the
+// stencil at their ends.
+template <int K>
+Winds QuietSurrogate::InterpolateTaps(const std::array<double, 4>& coords) const {
+  std::array<std::array<std::size_t, K>, 4> idx{};
+  std::array<std::array<double, K>, 4> wgt{};
+  for (std::size_t a = 0; a < 4; ++a) {
+    const auto& axis = axes_[a];
+    const int n = axis.count;
+    // Periodic coordinates are already reduced to [0, n], so one conditional wrap per tap suffices.
+    const int i = std::clamp(static_cast<int>(std::floor(coords[a])), 0, axis.periodic ? n - 1 : n - 2);
+    const double t = coords[a] - i;
+    if constexpr (K == 2) {
+      wgt[a] = {1.0 - t, t};
+    } else {
+      wgt[a] = detail::CubicWeights(t);
+    }
+    for (int k = 0; k < K; ++k) {
+      int j = i + k - (K == 4 ? 1 : 0);
+      if (axis.periodic) {
+        j = j < 0 ? j + n : (j >= n ? j - n : j);
+      } else {
+        j = std::clamp(j, 0, n - 1);
+      }
+      idx[a][static_cast<std::size_t>(k)] = static_cast<std::size_t>(j);
+    }
+  }
+
+  const auto& lattice = *lattice_;
+  const auto n1 = static_cast<std::size_t>(axes_[1].count);
+  const auto n2 = static_cast<std::size_t>(axes_[2].count);
+  const auto n3 = static_cast<std::size_t>(axes_[3].count);
+  Winds out{};
+  for (std::size_t a = 0; a < K; ++a) {
+    for (std::size_t b = 0; b < K; ++b) {
+      const double wab = wgt[0][a] * wgt[1][b];
+      for (std::size_t c = 0; c < K; ++c) {
+        const double wabc = wab * wgt[2][c];
+        const std::size_t row = ((idx[0][a] * n1 + idx[1][b]) * n2 + idx[2][c]) * n3;
+        for (std::size_t d = 0; d < K; ++d) {
+          const double w = wabc * wgt[3][d];
+          const auto& node = lattice[row + idx[3][d]];
+          out.meridional_mps += w * node.meridional_mps;
+          out.zonal_mps += w * node.zonal_mps;
+        }
+      }
+    }
+  }
+  return out;
+}
+
+}  // namespace hwm14
@@ -0,0 +1,292 @@
+/**
+ * @file quiet_truncation.cpp
+ * @brief Reduced-truncation quiet models derived from a loaded one, and quiet-wind comparison.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "hwm14/detail/model_impl.hpp"
+#include "hwm14/hwm14.hpp"
+
+namespace hwm14 {
+
+namespace {
+
+using detail::HwmOrderIdx;
+
+// Entries of one level's order table, in `HwmBinHeader::order` component order.
+enum OrderComponent : std::size_t { kAmaxs, kAmaxn, kPmaxm, kPmaxs, kPmaxn, kTmaxl, kTmaxs, kTmaxn };
+using LevelOrder = std::array<int, 8>;
+
+LevelOrder ReadLevelOrder(const detail::HwmBinHeader& h, int d) {
+  LevelOrder o{};
+  for (std::size_t k = 0; k < o.size(); ++k) {
+    o[k] = h.order[HwmOrderIdx(static_cast<int>(k), d, h.ncomp)];
+  }
+  return o;
+}
+
+void WriteLevelOrder(detail::HwmBinHeader& h, int d, const LevelOrder& o) {
+  for (std::size_t k = 0; k < o.size(); ++k) {
+    h.order[HwmOrderIdx(static_cast<int>(k), d, h.ncomp)] = o[k];
+  }
+}
+
+// Calls `f(key)` for every coefficient slot of a level truncated at `o`, in the column order
+// `FillQuietLevelBasis` writes them. A key names the same term under any truncation.
+template <typename F>
+void ForEachSlot(const LevelOrder& o, F&& f) {
+  const auto slots = [&f](std::int64_t family, std::int64_t wave, std::int64_t s, std::int64_t n, int count) {
+    for (int k = 0; k < count; ++k) {
+      f(((((family * 64 + wave) * 64 + s) * 64 + n) * 8) + k);
+    }
+  };
+  for (int n = 1; n <= o[kAmaxn]; ++n) {
+    slots(0, 0, 0, n, 2);
+  }
+  for (int s = 1; s <= o[kAmaxs]; ++s) {
+    for (int n = 1; n <= o[kAmaxn]; ++n) {
+      slots(0, 0, s, n, 4);
+    }
+  }
+  for (int m = 1; m <= o[kPmaxm]; ++m) {
+    for (int n = m; n <= o[kPmaxn]; ++n) {
+      slots(1, m, 0, n, 4);
+    }
+    for (int s = 1; s <= o[kPmaxs]; ++s) {
+      for (int n = m; n <= o[kPmaxn]; ++n) {
+        slots(1, m, s, n, 8);
+      }
+    }
+  }
+  for (int l = 1; l <= o[kTmaxl]; ++l) {
+    for (int n = l; n <= o[kTmaxn]; ++n) {
+      slots(2, l, 0, n, 4);
+    }
+    for (int s = 1; s <= o[kTmaxs]; ++s) {
+      for (int n = l; n <= o[kTmaxn]; ++n) {
+        slots(2, l, s, n, 8);
+      }
+    }
+  }
+}
+
+std::unordered_map<std::int64_t, std::size_t> SlotOffsets(const LevelOrder& o) {
+  std::unordered_map<std::int64_t, std::size_t> out;
+  ForEachSlot(o, [&out](std::int64_t key) { out.emplace(key, out.size()); });
+  return out;
+}
+
+std::size_t SlotCount(const LevelOrder& o) {
+  std::size_t n = 0;
+  ForEachSlot(o, [&n](std::int64_t) { ++n; });
+  return n;
+}
+
+LevelOrder CapLevelOrder(LevelOrder o, const QuietTruncation& t) {
+  const auto cap = [](int& entry, const std::optional<int>& limit) {
+    if (limit) {
+      entry = std::min(entry, *limit);
+    }
+  };
+  cap(o[kPmaxm], t.max_planetary_wave);
+  cap(o[kTmaxl], t.max_tide);
+  cap(o[kAmaxs], t.max_seasonal);
+  cap(o[kPmaxs], t.max_seasonal);
+  cap(o[kTmaxs], t.max_seasonal);
+  cap(o[kAmaxn], t.max_zonal_mean_degree);
+  cap(o[kPmaxn], t.max_wave_degree);
+  cap(o[kTmaxn], t.max_wave_degree);
+  return o;
+}
+
+// Lowers entries of `o` one step at a time while every slot a step removes holds zero in both columns,
+// which are laid out by `offsets` (a superset of the slots of `o`).
+LevelOrder TrimZeroOrders(LevelOrder o,
+                          const std::unordered_map<std::int64_t, std::size_t>& offsets,
+                          std::span<const double> mcol,
+                          std::span<const double> tcol) {
+  bool lowered = true;
+  while (lowered) {
+    lowered = false;
+    for (auto& entry : o) {
+      while (entry > 0) {
+        const auto before = SlotOffsets(o);
+        --entry;
+        const auto kept = SlotOffsets(o);
+        bool all_zero = true;
+        for (const auto& entry_slot : before) {
+          const std::size_t at = offsets.at(entry_slot.first);
+          if (!kept.contains(entry_slot.first) && (mcol[at] != 0.0 || tcol[at] != 0.0)) {
+            all_zero = false;
+            break;
+          }
+        }
+        if (!all_zero) {
+          ++entry;
+          break;
+        }
+        lowered = true;
+      }
+    }
+  }
+  return o;
+}
+
+// Copies the slots of `to` out of a column laid out by `from_offsets`; the rest of `dst` is zeroed.
+void RemapColumn(const std::unordered_map<std::int64_t, std::size_t>& from_offsets,
+                 const LevelOrder& to,
+                 std::span<const double> src,
+                 std::span<double> dst) {
+  std::fill(dst.begin(), dst.end(), 0.0);
+  std::size_t at = 0;
+  ForEachSlot(to, [&](std::int64_t key) { dst[at++] = src[from_offsets.at(key)]; });
+}
+
+}  // namespace
+
+namespace detail {
+
+void RemapQuietLevelColumn(const HwmBinHeader& from,
+                           const HwmBinHeader& to,
+                           int d,
+                           std::span<const double> src,
+                           std::span<double> dst) {
+  RemapColumn(SlotOffsets(ReadLevelOrder(from, d)), ReadLevelOrder(to, d), src, dst);
+}
+
+}  // namespace detail
+
+Result<Model, Error> Model::WithTruncation(const QuietTruncation& truncation) const {
+  for (const auto* cap : {&truncation.max_planetary_wave, &truncation.max_tide, &truncation.max_seasonal,
+                          &truncation.max_zonal_mean_degree, &truncation.max_wave_degree}) {
+    if (*cap && **cap < 0) {
+      return Result<Model, Error>::Err(MakeError(ErrorCode::kInvalidInput, "truncation caps must be non-negative",
+                                                 std::to_string(**cap), "Model::WithTruncation"));
+    }
+  }
+  const double threshold = truncation.coefficient_threshold;
+  if (!std::isfinite(threshold) || threshold < 0.0) {
+    return Result<Model, Error>::Err(MakeError(ErrorCode::kInvalidInput,
+                                               "coefficient_threshold must be finite and non-negative",
+                                               std::to_string(threshold), "Model::WithTruncation"));
+  }
+
+  auto impl = std::make_shared<Model::Impl>(*impl_);
+  auto& h = impl->hwm;
+  if (impl->loaded_order.empty()) {
+    impl->loaded_order = h.order;
+  }
+  const auto nbf = static_cast<std::size_t>(h.nbf);
+  const std::size_t held = impl->mparm.size() / nbf;
+  const auto members = static_cast<std::size_t>(impl->ensemble_members);
+
+  // Levels outside the held band are never evaluated; cap them too so the order table stays uniform.
+  for (int d = 0; d <= h.nnode; ++d) {
+    WriteLevelOrder(h, d, CapLevelOrder(ReadLevelOrder(impl_->hwm, d), truncation));
+  }
+
+  auto coeffs = std::make_shared<detail::QuietCoefficientStorage>();
+  coeffs->mparm.assign(held * nbf, 0.0);
+  coeffs->tparm.assign(held * nbf, 0.0);
+  std::vector<double> mcol(nbf);
+  std::vector<double> tcol(nbf);
+  for (std::size_t i = 0; i < held; ++i) {
+    const int d = impl->level_first + static_cast<int>(i);
+    const auto offsets = SlotOffsets(ReadLevelOrder(impl_->hwm, d));
+    std::copy_n(impl_->mparm.begin() + static_cast<std::ptrdiff_t>(nbf * i), nbf, mcol.begin());
+    std::copy_n(impl_->tparm.begin() + static_cast<std::ptrdiff_t>(nbf * i), nbf, tcol.begin());
+    LevelOrder to = ReadLevelOrder(h, d);
+    if (threshold > 0.0) {
+      for (std::size_t k = 0; k < nbf; ++k) {
+        mcol[k] = std::abs(mcol[k]) < threshold ? 0.0 : mcol[k];
+        tcol[k] = std::abs(tcol[k]) < threshold ? 0.0 : tcol[k];
+      }
+      to = TrimZeroOrders(to, offsets, mcol, tcol);
+      WriteLevelOrder(h, d, to);
+    }
+    RemapColumn(offsets, to, mcol, std::span<double>(coeffs->mparm).subspan(nbf * i, nbf));
+    RemapColumn(offsets, to, tcol, std::span<double>(coeffs->tparm).subspan(nbf * i, nbf));
+    for (std::size_t j = 0; j < members; ++j) {
+      const std::size_t off = nbf * (members * i + j);
+      const auto ens_m = std::span<const double>(impl_->ens_mparm).subspan(off, nbf);
+      const auto ens_t = std::span<const double>(impl_->ens_tparm).subspan(off, nbf);
+      RemapColumn(offsets, to, ens_m, std::span<double>(impl->ens_mparm).subspan(off, nbf));
+      RemapColumn(offsets, to, ens_t, std::span<double>(impl->ens_tparm).subspan(off, nbf));
+    }
+  }
+
+  // Shrink the harmonic and ALF dimensions to the largest orders left. The ALF recurrence over a smaller
+  // (maxn, maxo) yields the same values for the degrees it still covers.
+  int maxs = 0;
+  int maxm = 0;
+  int maxl = 0;
+  int maxn = 1;
+  for (int d = 0; d <= h.nnode; ++d) {
+    const auto o = ReadLevelOrder(h, d);
+    maxs = std::max({maxs, o[kAmaxs], o[kPmaxs], o[kTmaxs]});
+    maxm = std::max(maxm, o[kPmaxm]);
+    maxl = std::max(maxl, o[kTmaxl]);
+    maxn = std::max({maxn, o[kAmaxn], o[kPmaxn], o[kTmaxn]});
+  }
+  h.maxs = std::min(h.maxs, maxs);
+  h.maxm = std::min(h.maxm, maxm);
+  h.maxl = std::min(h.maxl, maxl);
+  impl->maxo = std::max({h.maxs, h.maxm, h.maxl});
+  h.maxn = std::min(h.maxn, std::max(maxn, impl->maxo));
+  if (h.maxn != impl_->hwm.maxn || impl->maxo != impl_->maxo) {
+    impl->alf.Init(h.maxn, impl->maxo);
+    detail::BindFixedAlfKernels(*impl);
+  }
+
+  impl->mparm = coeffs->mparm;
+  impl->tparm = coeffs->tparm;
+  if (!impl->mparm_f32.empty()) {
+    impl->mparm_f32.assign(impl->mparm.begin(), impl->mparm.end());
+    impl->tparm_f32.assign(impl->tparm.begin(), impl->tparm.end());
+  }
+  impl->coeff_storage = std::move(coeffs);
+  detail::BindQuietLevelKernels(*impl);
+  return Result<Model, Error>::Ok(Model(std::move(impl), options_));
+}
+
+std::size_t Model::QuietActiveTerms() const {
+  const auto& h = impl_->hwm;
+  const std::size_t held = impl_->mparm.size() / static_cast<std::size_t>(h.nbf);
+  std::size_t terms = 0;
+  for (std::size_t i = 0; i < held; ++i) {
+    terms += SlotCount(ReadLevelOrder(h, impl_->level_first + static_cast<int>(i)));
+  }
+  return terms;
+}
+
+Result<WindsDifference, Error> Model::CompareQuietWinds(const Model& reference, std::span<const Inputs> in) const {
+  WindsDifference out{};
+  double sum_sq = 0.0;
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    auto a = QuietWinds(in[i]);
+    auto b = a ? reference.QuietWinds(in[i]) : a;
+    if (!a || !b) {
+      auto err = !a ? a.error() : b.error();
+      err.detail = "row " + std::to_string(i);
+      return Result<WindsDifference, Error>::Err(std::move(err));
+    }
+    const double err = std::hypot(a.value().zonal_mps - b.value().zonal_mps,
+                                  a.value().meridional_mps - b.value().meridional_mps);
+    sum_sq += err * err;
+    out.max_mps = std::max(out.max_mps, err);
+  }
+  out.samples = in.size();
+  out.rms_mps = in.empty() ? 0.0 : std::sqrt(sum_sq / static_cast<double>(in.size()));
+  return Result<WindsDifference, Error>::Ok(out);
+}
+
+}  // namespace hwm14
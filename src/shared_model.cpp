@@ -0,0 +1,162 @@
+/**
+ * @file shared_model.cpp
+ * @brief Publishing and attaching models through named POSIX shared-memory segments.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "hwm14/detail/mapped_file.hpp"
+#include "hwm14/detail/model_blob.hpp"
+#include "hwm14/detail/model_impl.hpp"
+#include "hwm14/hwm14.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HWM14_HAVE_POSIX_SHM 1
+#endif
+
+namespace hwm14 {
+
+namespace {
+
+// POSIX shared-memory names must start with a single slash.
+std::string ShmName(std::string_view name) {
+  std::string out;
+  if (name.empty() || name.front() != '/') {
+    out.push_back('/');
+  }
+  out.append(name);
+  return out;
+}
+
+// The first 8 blob bytes (the magic) double as the segment's ready flag: the segment is zero-filled by
+// `ftruncate`, and the publisher stores them last with release semantics once everything else is written.
+constexpr std::size_t kReadyBytes = sizeof(std::uint64_t);
+static_assert(std::atomic_ref<std::uint64_t>::is_always_lock_free, "ready flag is loaded from a read-only mapping");
+
+std::atomic_ref<std::uint64_t> ReadyFlag(void* segment) {
+  return std::atomic_ref<std::uint64_t>(*static_cast<std::uint64_t*>(segment));
+}
+
+}  // namespace
+
+Result<std::size_t, Error> Model::PublishShared(std::string_view name) const {
+#ifdef HWM14_HAVE_POSIX_SHM
+  const auto blob = detail::SerializeModelBlob(*impl_);
+  if (!blob) {
+    return Result<std::size_t, Error>::Err(blob.error());
+  }
+  const auto& bytes = blob.value();
+  const std::string shm = ShmName(name);
+
+  // Replace any previous segment; processes still attached to it keep their mapping.
+  ::shm_unlink(shm.c_str());
+  const int fd = ::shm_open(shm.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    return Result<std::size_t, Error>::Err(
+        MakeError(ErrorCode::kDataFileOpenFailed, "shm_open failed", shm, "Model::PublishShared"));
+  }
+  if (::ftruncate(fd, static_cast<off_t>(bytes.size())) != 0) {
+    ::close(fd);
+    ::shm_unlink(shm.c_str());
+    return Result<std::size_t, Error>::Err(
+        MakeError(ErrorCode::kDataFileOpenFailed, "ftruncate failed", shm, "Model::PublishShared"));
+  }
+  void* addr = ::mmap(nullptr, bytes.size(), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    ::shm_unlink(shm.c_str());
+    return Result<std::size_t, Error>::Err(
+        MakeError(ErrorCode::kDataFileOpenFailed, "mmap failed", shm, "Model::PublishShared"));
+  }
+
+  auto* dst = static_cast<std::byte*>(addr);
+  std::memcpy(dst + kReadyBytes, bytes.data() + kReadyBytes, bytes.size() - kReadyBytes);
+  std::uint64_t ready = 0;
+  std::memcpy(&ready, bytes.data(), kReadyBytes);
+  ReadyFlag(addr).store(ready, std::memory_order_release);
+  ::munmap(addr, bytes.size());
+  return Result<std::size_t, Error>::Ok(bytes.size());
+#else
+  (void)name;
+  return Result<std::size_t, Error>::Err(
+      MakeError(ErrorCode::kNotImplemented, "POSIX shared memory unavailable", {}, "Model::PublishShared"));
+#endif
+}
+
+Result<Model, Error> Model::AttachShared(std::string_view name, Options options) {
+#ifdef HWM14_HAVE_POSIX_SHM
+  if (auto err = detail::ValidateBlobOptions(options, "Model::AttachShared")) {
+    return Result<Model, Error>::Err(std::move(*err));
+  }
+  const std::string shm = ShmName(name);
+  const int fd = ::shm_open(shm.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return Result<Model, Error>::Err(
+        MakeError(ErrorCode::kDataPathNotFound, "shared model segment not found", shm, "Model::AttachShared"));
+  }
+  struct stat st {};
+  if (::fstat(fd, &st) != 0 || st.st_size <= 0) {
+    ::close(fd);
+    return Result<Model, Error>::Err(
+        MakeError(ErrorCode::kDataFileParseFailed, "shared model segment is empty", shm, "Model::AttachShared"));
+  }
+  const auto size = static_cast<std::size_t>(st.st_size);
+  void* addr = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    return Result<Model, Error>::Err(
+        MakeError(ErrorCode::kDataFileOpenFailed, "mmap failed", shm, "Model::AttachShared"));
+  }
+  if (size < kReadyBytes || ReadyFlag(addr).load(std::memory_order_acquire) == 0) {
+    ::munmap(addr, size);
+    return Result<Model, Error>::Err(MakeError(ErrorCode::kDataFileParseFailed,
+                                               "shared model segment is still being published", shm,
+                                               "Model::AttachShared"));
+  }
+
+  auto mapping = detail::MappedFile::AdoptMapping(addr, size);
+  auto impl = detail::ModelImplFromBlob(mapping->bytes(), mapping, options.verify_blob_checksum, "Model::AttachShared");
+  if (!impl) {
+    auto err = impl.error();
+    err.detail = shm + (err.detail.empty() ? "" : ": " + err.detail);
+    return Result<Model, Error>::Err(std::move(err));
+  }
+  detail::BindEvalOptions(*impl.value(), options);
+  return Result<Model, Error>::Ok(Model(std::move(impl.value()), std::move(options)));
+#else
+  (void)name;
+  (void)options;
+  return Result<Model, Error>::Err(
+      MakeError(ErrorCode::kNotImplemented, "POSIX shared memory unavailable", {}, "Model::AttachShared"));
+#endif
+}
+
+Result<Model, Error> Model::AttachSharedOrLoad(std::string_view name, Options options) {
+  auto shared = AttachShared(name, options);
+  if (shared) {
+    return shared;
+  }
+  auto paths = ResolveDataPaths(options);
+  if (!paths) {
+    return Result<Model, Error>::Err(paths.error());
+  }
+  return LoadFromResolvedPaths(std::move(paths.value()), std::move(options));
+}
+
+bool Model::UnlinkShared(std::string_view name) {
+#ifdef HWM14_HAVE_POSIX_SHM
+  return ::shm_unlink(ShmName(name).c_str()) == 0;
+#else
+  (void)name;
+  return false;
+#endif
+}
+
+}  // namespace hwm14
@@ -0,0 +1,211 @@
+/**
+ * @file track_evaluator.cpp
+ * @brief Rotation-advanced harmonics for sequences of nearby evaluation points.
+ */
+
+#include "hwm14/track_evaluator.hpp"
+
+#include <array>
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hwm14/detail/model_impl.hpp"
+
+namespace hwm14 {
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+constexpr double kTwoPi = 2.0 * kPi;
+constexpr double kDeg2Rad = kTwoPi / 360.0;
+// The disturbance evaluators scale MLT by `kPi / 180`; the refills only match them if this is the same value.
+static_assert(kDeg2Rad == kPi / 180.0);
+// Taylor terms below cover steps up to this size to within a few 1e-18.
+constexpr double kMaxStepRad = 0.25;
+
+// An angle with its cosine and sine, advanced by rotation between refills.
+struct Rotor {
+  double angle{};
+  double c{1.0};
+  double s{};
+};
+
+Rotor ExactRotor(double angle) { return {angle, std::cos(angle), std::sin(angle)}; }
+
+// Step from `r.angle` to `angle` reduced to (-pi, pi], or NaN when it exceeds `max_step`.
+double RotorStep(const Rotor& r, double angle, double max_step) {
+  const double delta = std::remainder(angle - r.angle, kTwoPi);
+  return std::abs(delta) <= max_step ? delta : std::nan("");
+}
+
+// Rotates `r` by `delta` (|delta| <= kMaxStepRad) using truncated Taylor series for cos and sin.
+void Rotate(Rotor& r, double angle, double delta) {
+  const double d2 = delta * delta;
+  const double sd =
+      delta * (1.0 - d2 / 6.0 * (1.0 - d2 / 20.0 * (1.0 - d2 / 42.0 * (1.0 - d2 / 72.0 * (1.0 - d2 / 110.0)))));
+  const double cd =
+      1.0 - d2 / 2.0 *
+                (1.0 - d2 / 12.0 * (1.0 - d2 / 30.0 * (1.0 - d2 / 56.0 * (1.0 - d2 / 90.0 * (1.0 - d2 / 132.0)))));
+  const double c = r.c * cd - r.s * sd;
+  const double s = r.s * cd + r.c * sd;
+  r = {angle, c, s};
+}
+
+// Writes {cos(k a), sin(k a)} for k = 0..kmax to `cs` by repeated rotation through the fundamental.
+void FillMultiples(const Rotor& r, int kmax, double* cs) {
+  cs[0] = 1.0;
+  cs[1] = 0.0;
+  for (int k = 1; k <= kmax; ++k) {
+    const double c = cs[2 * k - 2];
+    const double s = cs[2 * k - 1];
+    cs[2 * k] = c * r.c - s * r.s;
+    cs[2 * k + 1] = s * r.c + c * r.s;
+  }
+}
+
+// The quiet-basis angles of `in`, computed as `detail::FillQuietHarmonics` does: local time,
+// longitude and colatitude.
+std::array<double, 3> QuietAngles(const Inputs& in) {
+  const double stl = std::fmod(in.ut_seconds / 3600.0 + in.geodetic_lon_deg / 15.0 + 48.0, 24.0);
+  return {stl * kTwoPi / 24.0, in.geodetic_lon_deg * kDeg2Rad, (90.0 - in.geodetic_lat_deg) * kDeg2Rad};
+}
+
+}  // namespace
+
+struct TrackEvaluator::State {
+  Model model;
+  TrackOptions options{};
+  TrackStats stats{};
+
+  detail::QuietHarmonics quiet{};
+  std::array<Rotor, 3> quiet_rotors{};  // local time, longitude, colatitude
+  std::vector<double> multiples{};      // {cos, sin} of the colatitude multiples
+  int yyddd{};
+  bool quiet_valid{false};
+  std::size_t quiet_since_refill{};
+
+  std::vector<std::array<double, 2>> mlt{};
+  Rotor mlt_rotor{};
+  bool mlt_valid{false};
+  std::size_t mlt_since_refill{};
+
+  // Brings `quiet` to the harmonics of `in`, by rotation when every angle stepped a little.
+  void AdvanceQuiet(const Inputs& in) {
+    const auto& h = model.impl_->hwm;
+    const auto angles = QuietAngles(in);
+    std::array<double, 3> steps{};
+    bool rotate = quiet_valid && in.yyddd == yyddd && quiet_since_refill < options.resync_interval;
+    for (std::size_t a = 0; rotate && a < angles.size(); ++a) {
+      steps[a] = RotorStep(quiet_rotors[a], angles[a], options.max_step_rad);
+      rotate = !std::isnan(steps[a]);
+    }
+    if (!rotate) {
+      detail::FillQuietHarmonics(*model.impl_, in, quiet);
+      for (std::size_t a = 0; a < angles.size(); ++a) {
+        quiet_rotors[a] = ExactRotor(angles[a]);
+      }
+      yyddd = in.yyddd;
+      quiet_valid = true;
+      quiet_since_refill = 1;
+      ++stats.quiet_resyncs;
+      return;
+    }
+
+    for (std::size_t a = 0; a < angles.size(); ++a) {
+      Rotate(quiet_rotors[a], angles[a], steps[a]);
+    }
+    FillMultiples(quiet_rotors[0], h.maxl, quiet.fl.data());
+    FillMultiples(quiet_rotors[1], h.maxm, quiet.fm.data());
+    multiples.resize(static_cast<std::size_t>(h.maxn + 1) * 2U);
+    FillMultiples(quiet_rotors[2], h.maxn, multiples.data());
+    for (int n = 0; n <= h.maxn; ++n) {
+      quiet.sn[static_cast<std::size_t>(n)] = multiples[static_cast<std::size_t>(2 * n + 1)];
+    }
+    ++quiet_since_refill;
+  }
+
+  // Brings `mlt` to the MLT harmonics of `mlt_h`, by rotation when the MLT angle stepped a little.
+  void AdvanceMlt(const detail::DisturbanceTables& dist, double mlt_h) {
+    const double angle = mlt_h * kDeg2Rad * 15.0;
+    const double step = mlt_valid && mlt_since_refill < options.resync_interval
+                            ? RotorStep(mlt_rotor, angle, options.max_step_rad)
+                            : std::nan("");
+    if (std::isnan(step)) {
+      detail::FillMltHarmonics(dist, mlt_h, mlt);
+      mlt_rotor = ExactRotor(angle);
+      mlt_valid = true;
+      mlt_since_refill = 1;
+      ++stats.mlt_resyncs;
+      return;
+    }
+    Rotate(mlt_rotor, angle, step);
+    for (std::size_t m = 1; m < mlt.size(); ++m) {
+      const auto prev = mlt[m - 1];
+      mlt[m] = {prev[0] * mlt_rotor.c - prev[1] * mlt_rotor.s, prev[1] * mlt_rotor.c + prev[0] * mlt_rotor.s};
+    }
+    ++mlt_since_refill;
+  }
+
+  Result<Winds, Error> Quiet(const Inputs& in, std::string_view where) {
+    if (auto err = detail::ValidateInputs(*model.impl_, in, where)) {
+      return Result<Winds, Error>::Err(std::move(*err));
+    }
+    ++stats.evaluations;
+    AdvanceQuiet(in);
+    return Result<Winds, Error>::Ok(detail::QuietWindsWithHarmonics(*model.impl_, in, quiet));
+  }
+};
+
+TrackEvaluator::TrackEvaluator(std::unique_ptr<State> state) : state_(std::move(state)) {}
+TrackEvaluator::TrackEvaluator(TrackEvaluator&&) noexcept = default;
+TrackEvaluator& TrackEvaluator::operator=(TrackEvaluator&&) noexcept = default;
+TrackEvaluator::~TrackEvaluator() = default;
+
+Result<TrackEvaluator, Error> TrackEvaluator::Create(Model model, const TrackOptions& options) {
+  if (options.resync_interval == 0 || !(options.max_step_rad >= 0.0 && options.max_step_rad <= kMaxStepRad)) {
+    return Result<TrackEvaluator, Error>::Err(
+        MakeError(ErrorCode::kInvalidInput, "resync_interval must be at least 1 and max_step_rad within [0, 0.25]",
+                  std::to_string(options.max_step_rad), "TrackEvaluator::Create"));
+  }
+  auto state = std::make_unique<State>(State{std::move(model), options});
+  return Result<TrackEvaluator, Error>::Ok(TrackEvaluator(std::move(state)));
+}
+
+Result<Winds, Error> TrackEvaluator::QuietWinds(const Inputs& in) {
+  return state_->Quiet(in, "TrackEvaluator::QuietWinds");
+}
+
+Result<Winds, Error> TrackEvaluator::TotalWinds(const Inputs& in) {
+  auto& st = *state_;
+  auto q = st.Quiet(in, "TrackEvaluator::TotalWinds");
+  if (!q || in.ap3 < 0.0) {
+    return q;
+  }
+
+  const auto qd = st.model.GeoToQd(in);
+  if (!qd) {
+    return Result<Winds, Error>::Err(qd.error());
+  }
+  const auto dist = detail::ResolveDisturbance(*st.model.impl_, "TrackEvaluator::TotalWinds");
+  if (!dist) {
+    return Result<Winds, Error>::Err(dist.error());
+  }
+  st.AdvanceMlt(*dist.value(), qd.value().mlt_h);
+  const Winds d =
+      detail::DisturbanceWindsWithMltHarmonics(*dist.value(), in, qd.value(), st.mlt, st.model.options_.enable_cache);
+
+  Winds out{};
+  out.meridional_mps = q.value().meridional_mps + d.meridional_mps;
+  out.zonal_mps = q.value().zonal_mps + d.zonal_mps;
+  return Result<Winds, Error>::Ok(out);
+}
+
+void TrackEvaluator::Reset() {
+  state_->quiet_valid = false;
+  state_->mlt_valid = false;
+}
+
+const TrackStats& TrackEvaluator::Stats() const { return state_->stats; }
+
+}  // namespace hwm14
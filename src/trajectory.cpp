@@ -0,0 +1,199 @@
+/**
+ * @file trajectory.cpp
+ * @brief Adaptive-knot Hermite evaluation of total winds along time-ordered trajectories.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "hwm14/detail/model_impl.hpp"
+#include "hwm14/detail/time_utils.hpp"
+#include "hwm14/hwm14.hpp"
+
+namespace hwm14 {
+
+namespace {
+
+constexpr const char* kWhere = "Model::EvaluateTrajectory";
+
+// Days from YY 00 day 0 to `yyddd`, counting every YY divisible by 4 as a leap year (1901-2099 rule).
+// Two-digit years are unwrapped to the first year at or after `first_yy` (also two-digit), so 99365 is
+// followed by 00001.
+double DaySerial(int yyddd, int first_yy) {
+  const auto d = detail::DecodeYyddd(yyddd).value();
+  int yy = d.yy;
+  if (yy < 100 && first_yy < 100) {
+    yy = first_yy + (yy - first_yy + 100) % 100;
+  }
+  return 365.0 * yy + static_cast<double>((yy + 3) / 4) + d.day_of_year;
+}
+
+// A Hermite knot: its sample, the exact winds there, and their time derivatives.
+struct Knot {
+  std::size_t sample{};
+  Winds w{};
+  Winds dw{};
+};
+
+// Derivatives at every knot: weighted two-sided differences inside, one-sided at the segment ends.
+void KnotDerivatives(std::vector<Knot>& knots, const std::vector<double>& t) {
+  const std::size_t n = knots.size();
+  const auto slope = [&](std::size_t a, std::size_t b) {
+    const double h = t[knots[b].sample] - t[knots[a].sample];
+    return Winds{(knots[b].w.meridional_mps - knots[a].w.meridional_mps) / h,
+                 (knots[b].w.zonal_mps - knots[a].w.zonal_mps) / h};
+  };
+  if (n < 2) {
+    for (auto& k : knots) {
+      k.dw = {};
+    }
+    return;
+  }
+  knots.front().dw = slope(0, 1);
+  knots.back().dw = slope(n - 2, n - 1);
+  for (std::size_t i = 1; i + 1 < n; ++i) {
+    const double h0 = t[knots[i].sample] - t[knots[i - 1].sample];
+    const double h1 = t[knots[i + 1].sample] - t[knots[i].sample];
+    const Winds s0 = slope(i - 1, i);
+    const Winds s1 = slope(i, i + 1);
+    // Derivative of the parabola through the three knots, exact for quadratics on uneven spacing.
+    knots[i].dw = {(h1 * s0.meridional_mps + h0 * s1.meridional_mps) / (h0 + h1),
+                   (h1 * s0.zonal_mps + h0 * s1.zonal_mps) / (h0 + h1)};
+  }
+}
+
+Winds Hermite(const Knot& a, const Knot& b, const std::vector<double>& t, std::size_t sample) {
+  const double h = t[b.sample] - t[a.sample];
+  const double s = (t[sample] - t[a.sample]) / h;
+  const double s2 = s * s;
+  const double s3 = s2 * s;
+  const double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+  const double h10 = (s3 - 2.0 * s2 + s) * h;
+  const double h01 = -2.0 * s3 + 3.0 * s2;
+  const double h11 = (s3 - s2) * h;
+  return {h00 * a.w.meridional_mps + h10 * a.dw.meridional_mps + h01 * b.w.meridional_mps + h11 * b.dw.meridional_mps,
+          h00 * a.w.zonal_mps + h10 * a.dw.zonal_mps + h01 * b.w.zonal_mps + h11 * b.dw.zonal_mps};
+}
+
+}  // namespace
+
+Result<TrajectoryReport, Error> Model::EvaluateTrajectory(std::span<const Inputs> in,
+                                                          std::span<Winds> out,
+                                                          const TrajectoryOptions& options) const {
+  using R = Result<TrajectoryReport, Error>;
+  if (!std::isfinite(options.tolerance_mps) || options.tolerance_mps < 0.0 || options.initial_knot_stride == 0) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput,
+                            "tolerance_mps must be finite and non-negative, initial_knot_stride at least 1", {},
+                            kWhere));
+  }
+  if (out.size() < in.size()) {
+    return R::Err(MakeError(ErrorCode::kInvalidInput, "output buffer smaller than the input batch",
+                            std::to_string(out.size()), kWhere));
+  }
+
+  // Times relative to the first sample keep sub-millisecond resolution over long trajectories.
+  std::vector<double> t(in.size());
+  const int first_yy = in.empty() ? 0 : in[0].yyddd / 1000;
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    if (auto err = detail::ValidateInputs(*impl_, in[i], kWhere)) {
+      err->detail = "row " + std::to_string(i);
+      return R::Err(std::move(*err));
+    }
+    t[i] = (DaySerial(in[i].yyddd, first_yy) - DaySerial(in[0].yyddd, first_yy)) * 86400.0 +
+           (in[i].ut_seconds - in[0].ut_seconds);
+    if (i > 0 && !(t[i] > t[i - 1])) {
+      return R::Err(MakeError(ErrorCode::kInvalidInput, "trajectory times must be strictly increasing",
+                              "row " + std::to_string(i), kWhere));
+    }
+  }
+
+  TrajectoryReport report{};
+  report.samples = in.size();
+  std::vector<Winds> exact(in.size());
+  std::vector<char> known(in.size(), 0);
+  const auto evaluate = [&](std::size_t i) -> std::optional<Error> {
+    if (known[i]) {
+      return std::nullopt;
+    }
+    auto w = TotalWinds(in[i]);
+    if (!w) {
+      auto err = w.error();
+      err.detail = "row " + std::to_string(i);
+      return err;
+    }
+    exact[i] = w.value();
+    known[i] = 1;
+    ++report.exact_evaluations;
+    return std::nullopt;
+  };
+
+  std::vector<Knot> knots;
+  std::vector<Knot> refined;
+  std::size_t first = 0;
+  while (first < in.size()) {
+    std::size_t last = first;
+    while (last + 1 < in.size() && in[last + 1].yyddd == in[first].yyddd && in[last + 1].ap3 == in[first].ap3) {
+      ++last;
+    }
+    ++report.segments;
+
+    knots.clear();
+    for (std::size_t i = first;; i += std::min(options.initial_knot_stride, last - i)) {
+      if (auto err = evaluate(i)) {
+        return R::Err(std::move(*err));
+      }
+      knots.push_back({i, exact[i], {}});
+      if (i == last) {
+        break;
+      }
+    }
+
+    // Split every interval whose middle sample misses the tolerance until all intervals pass.
+    double max_check = 0.0;
+    for (bool split = true; split;) {
+      split = false;
+      max_check = 0.0;
+      KnotDerivatives(knots, t);
+      refined.clear();
+      for (std::size_t k = 0; k + 1 < knots.size(); ++k) {
+        refined.push_back(knots[k]);
+        const std::size_t a = knots[k].sample;
+        const std::size_t b = knots[k + 1].sample;
+        if (b - a < 2) {
+          continue;
+        }
+        const std::size_t mid = a + (b - a) / 2;
+        if (auto err = evaluate(mid)) {
+          return R::Err(std::move(*err));
+        }
+        const Winds guess = Hermite(knots[k], knots[k + 1], t, mid);
+        const double error = std::hypot(guess.meridional_mps - exact[mid].meridional_mps,
+                                        guess.zonal_mps - exact[mid].zonal_mps);
+        if (error > options.tolerance_mps) {
+          refined.push_back({mid, exact[mid], {}});
+          split = true;
+        } else {
+          max_check = std::max(max_check, error);
+        }
+      }
+      refined.push_back(knots.back());
+      knots.swap(refined);
+    }
+    report.max_check_error_mps = std::max(report.max_check_error_mps, max_check);
+    report.knots += knots.size();
+
+    for (std::size_t k = 0; k + 1 < knots.size(); ++k) {
+      for (std::size_t i = knots[k].sample; i < knots[k + 1].sample; ++i) {
+        out[i] = known[i] ? exact[i] : Hermite(knots[k], knots[k + 1], t, i);
+      }
+    }
+    out[last] = exact[last];
+    first = last + 1;
+  }
+  return R::Ok(report);
+}
+
+}  // namespace hwm14
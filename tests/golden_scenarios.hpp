@@ -0,0 +1,163 @@
+/**
+ * @file golden_scenarios.hpp
+ * @brief Shared reader for testdata/golden_profiles.csv and the deterministic input sweep used by tests.
+ */
+#pragma once
+
+// Author: watsonryan
+// Purpose: Parse golden profile rows, map each scenario to the model inputs it was generated with, and
+// generate broad input sweeps.
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace hwm14::test {
+
+/** @brief One golden_profiles.csv row: scenario, swept variable, and reference quiet/disturbance/total winds. */
+struct GoldenRow {
+  std::string scenario;
+  std::string x_name;
+  double x{};
+  double qmer{};
+  double qzon{};
+  double dmer{};
+  double dzon{};
+  double tmer{};
+  double tzon{};
+};
+
+/** @brief Parity tolerance in m/s for a scenario's reference winds. */
+inline double ScenarioTolerance(const std::string& scenario) {
+  if (scenario == "local time profile") {
+    return 1.2e-1;
+  }
+  if (scenario == "latitude profile") {
+    return 5e-2;
+  }
+  return 2e-2;
+}
+
+inline std::vector<std::string> Split(const std::string& s) {
+  std::vector<std::string> out;
+  std::string cur;
+  for (char c : s) {
+    if (c == ',') {
+      out.push_back(cur);
+      cur.clear();
+    } else {
+      cur.push_back(c);
+    }
+  }
+  out.push_back(cur);
+  return out;
+}
+
+/** @brief Inputs of `r`'s scenario at its swept value; false for an unknown scenario. */
+inline bool BuildInputs(const GoldenRow& r, Inputs& in) {
+  if (r.scenario == "height profile") {
+    in.yyddd = 95150;
+    in.ut_seconds = 12.0 * 3600.0;
+    in.altitude_km = r.x;
+    in.geodetic_lat_deg = -45.0;
+    in.geodetic_lon_deg = -85.0;
+    in.ap3 = 80.0;
+    return true;
+  }
+  if (r.scenario == "latitude profile") {
+    in.yyddd = 95305;
+    in.ut_seconds = 18.0 * 3600.0;
+    in.altitude_km = 250.0;
+    in.geodetic_lat_deg = r.x;
+    in.geodetic_lon_deg = 30.0;
+    in.ap3 = 48.0;
+    return true;
+  }
+  if (r.scenario == "local time profile") {
+    in.yyddd = 95075;
+    const double glon = -70.0;
+    const double uth = std::fmod(r.x - glon / 15.0 + 24.0, 24.0);
+    in.ut_seconds = uth * 3600.0;
+    in.altitude_km = 125.0;
+    in.geodetic_lat_deg = 45.0;
+    in.geodetic_lon_deg = glon;
+    in.ap3 = 30.0;
+    return true;
+  }
+  if (r.scenario == "longitude profile") {
+    in.yyddd = 95330;
+    in.ut_seconds = 6.0 * 3600.0;
+    in.altitude_km = 40.0;
+    in.geodetic_lat_deg = -5.0;
+    in.geodetic_lon_deg = r.x;
+    in.ap3 = 4.0;
+    return true;
+  }
+  if (r.scenario == "day of year profile") {
+    in.yyddd = 95000 + static_cast<int>(std::llround(r.x));
+    in.ut_seconds = 21.0 * 3600.0;
+    in.altitude_km = 200.0;
+    in.geodetic_lat_deg = -65.0;
+    in.geodetic_lon_deg = -135.0;
+    in.ap3 = 15.0;
+    return true;
+  }
+  if (r.scenario == "magnetic activity profile") {
+    in.yyddd = 95280;
+    in.ut_seconds = 21.0 * 3600.0;
+    in.altitude_km = 350.0;
+    in.geodetic_lat_deg = 38.0;
+    in.geodetic_lon_deg = 125.0;
+    in.ap3 = r.x;
+    return true;
+  }
+  return false;
+}
+
+/** @brief Input `i` of a deterministic sweep over day, time, altitude and position; every fourth has `ap3 = -1`. */
+inline Inputs SweepInput(int i) {
+  Inputs in{};
+  in.yyddd = 95001 + (i * 37) % 365;
+  in.ut_seconds = 1234.0 * (i % 70);
+  in.altitude_km = 2.5 * (i % 200);
+  in.geodetic_lat_deg = -89.0 + (i * 7) % 179;
+  in.geodetic_lon_deg = -180.0 + (i * 13) % 360;
+  in.ap3 = (i % 4 == 0) ? -1.0 : 4.0 * (i % 50);
+  return in;
+}
+
+/** @brief Read every data row of `csv_path`; false if the file is missing or a row is malformed. */
+inline bool LoadGoldenRows(const std::filesystem::path& csv_path, std::vector<GoldenRow>& out) {
+  std::ifstream csv(csv_path);
+  std::string line;
+  if (!csv || !std::getline(csv, line)) {
+    return false;
+  }
+  while (std::getline(csv, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    const auto c = Split(line);
+    if (c.size() != 9) {
+      return false;
+    }
+    GoldenRow r{};
+    r.scenario = c[0];
+    r.x_name = c[1];
+    r.x = std::stod(c[2]);
+    r.qmer = std::stod(c[3]);
+    r.qzon = std::stod(c[4]);
+    r.dmer = std::stod(c[5]);
+    r.dzon = std::stod(c[6]);
+    r.tmer = std::stod(c[7]);
+    r.tzon = std::stod(c[8]);
+    out.push_back(r);
+  }
+  return true;
+}
+
+}  // namespace hwm14::test
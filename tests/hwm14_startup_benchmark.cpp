@@ -0,0 +1,64 @@
+// Author: watsonryan
+// Purpose: Measure model startup cost per phase (file parse, derivation) for serial and parallel loads.
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+#include "hwm14/detail/dwm_loader.hpp"
+#include "hwm14/detail/gd2qd_loader.hpp"
+#include "hwm14/detail/hwm_bin_loader.hpp"
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+int ReadEnvInt(const char* name, int fallback) {
+  if (const char* v = std::getenv(name)) {
+    const int x = std::atoi(v);
+    if (x > 0) {
+      return x;
+    }
+  }
+  return fallback;
+}
+
+// Returns the mean wall time of `fn` in microseconds, or a negative value if it reports failure.
+template <typename Fn>
+double MeanMicros(int repeats, Fn&& fn) {
+  const auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < repeats; ++i) {
+    if (!fn()) {
+      return -1.0;
+    }
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(t1 - t0).count() / static_cast<double>(repeats);
+}
+
+}  // namespace
+
+int main() {
+  const int repeats = ReadEnvInt("HWM14_STARTUP_REPEATS", 20);
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+
+  const double hwm_us = MeanMicros(repeats, [&] { return static_cast<bool>(hwm14::detail::LoadHwmBinHeader(dir / "hwm123114.bin")); });
+  const double gd2qd_us = MeanMicros(repeats, [&] { return static_cast<bool>(hwm14::detail::LoadGd2qdData(dir / "gd2qd.dat")); });
+  const double dwm_us = MeanMicros(repeats, [&] { return static_cast<bool>(hwm14::detail::LoadDwmData(dir / "dwm07b104i.dat")); });
+
+  hwm14::Options parallel{};
+  parallel.parallel_load = true;
+  const double serial_us = MeanMicros(repeats, [&] { return static_cast<bool>(hwm14::Model::LoadFromDirectory(dir)); });
+  const double parallel_us =
+      MeanMicros(repeats, [&] { return static_cast<bool>(hwm14::Model::LoadFromDirectory(dir, parallel)); });
+  if (hwm_us < 0.0 || gd2qd_us < 0.0 || dwm_us < 0.0 || serial_us < 0.0 || parallel_us < 0.0) {
+    std::cerr << "load failed\n";
+    return EXIT_FAILURE;
+  }
+
+  const double parse_us = hwm_us + gd2qd_us + dwm_us;
+  std::cout << "repeats=" << repeats << " parse_hwm_us=" << hwm_us << " parse_gd2qd_us=" << gd2qd_us
+            << " parse_dwm_us=" << dwm_us << " derive_serial_us=" << (serial_us - parse_us)
+            << " load_serial_us=" << serial_us << " load_parallel_us=" << parallel_us << "\n";
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,100 @@
+// Author: watsonryan
+// Purpose: Validate altitude-banded partial loading against a full model.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+hwm14::Inputs MakeInput(double alt_km, int i) {
+  hwm14::Inputs in{};
+  in.yyddd = 95060 + i * 17;
+  in.ut_seconds = 3600.0 * i;
+  in.altitude_km = alt_km;
+  in.geodetic_lat_deg = -70.0 + 11.0 * i;
+  in.geodetic_lon_deg = -150.0 + 23.0 * i;
+  in.ap3 = -1.0;
+  return in;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto full = hwm14::Model::LoadFromDirectory(dir);
+  hwm14::Options opts{};
+  opts.altitude_band = hwm14::AltitudeBand{90.0, 130.0};
+  auto banded = hwm14::Model::LoadFromDirectory(dir, opts);
+  if (!full || !banded) {
+    return EXIT_FAILURE;
+  }
+  const auto& f = full.value();
+  const auto& b = banded.value();
+  if (b.QuietDesignColumns() >= f.QuietDesignColumns() || b.QuietFirstLevel() == 0 ||
+      b.QuietZonalCoefficients().size() != b.QuietDesignColumns()) {
+    return EXIT_FAILURE;
+  }
+
+  // Inside the band, including both edges, results are bit-identical to the full model.
+  for (const double alt : {90.0, 97.5, 110.0, 117.5, 124.0, 130.0}) {
+    for (int i = 0; i < 12; ++i) {
+      const auto want = f.QuietWinds(MakeInput(alt, i));
+      const auto got = b.QuietWinds(MakeInput(alt, i));
+      if (!want || !got || want.value().zonal_mps != got.value().zonal_mps ||
+          want.value().meridional_mps != got.value().meridional_mps) {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Design rows use band-relative columns and still reproduce the winds.
+  const std::vector<hwm14::Inputs> rows = {MakeInput(100.0, 1), MakeInput(125.0, 5)};
+  std::vector<double> dense(rows.size() * b.QuietDesignColumns());
+  if (!b.QuietDesignMatrixDense(rows, dense)) {
+    return EXIT_FAILURE;
+  }
+  const auto coeffs = b.QuietZonalCoefficients();
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    double u = 0.0;
+    for (std::size_t c = 0; c < coeffs.size(); ++c) {
+      u += dense[i * coeffs.size() + c] * coeffs[c];
+    }
+    const auto want = f.QuietWinds(rows[i]);
+    if (!want || std::abs(u - want.value().zonal_mps) > 1e-9 * (1.0 + std::abs(want.value().zonal_mps))) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Outside the band every quiet entry point rejects the input.
+  for (const double alt : {89.9, 130.1, 300.0}) {
+    const auto q = b.QuietWinds(MakeInput(alt, 0));
+    const auto t = b.TotalWinds(MakeInput(alt, 0));
+    if (q || q.error().code != hwm14::ErrorCode::kInvalidInput || t) {
+      return EXIT_FAILURE;
+    }
+  }
+  if (b.QuietDesignMatrixDense(std::vector<hwm14::Inputs>{MakeInput(200.0, 0)}, dense)) {
+    return EXIT_FAILURE;
+  }
+
+  // Disturbance winds do not depend on the quiet levels and remain available.
+  if (!b.DisturbanceWindsMag(12.0, 60.0, 4.0)) {
+    return EXIT_FAILURE;
+  }
+
+  // Malformed bands fail at load.
+  for (const auto band : {hwm14::AltitudeBand{130.0, 90.0}, hwm14::AltitudeBand{-1.0, 100.0}}) {
+    hwm14::Options bad{};
+    bad.altitude_band = band;
+    const auto m = hwm14::Model::LoadFromDirectory(dir, bad);
+    if (m || m.error().code != hwm14::ErrorCode::kInvalidInput) {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
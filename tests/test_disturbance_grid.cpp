@@ -0,0 +1,100 @@
+// Author: watsonryan
+// Purpose: Validate the mlat x MLT x Kp disturbance grid against point DisturbanceWindsMag calls.
+
+#include <cstdlib>
+#include <filesystem>
+#include <limits>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+bool GridMatchesPoints(const hwm14::Model& model) {
+  const std::vector<double> mlat = {-88.5, -60.0, -12.25, 0.0, 33.3, 71.0, 89.9};
+  const std::vector<double> mlt = {0.0, 3.5, 11.75, 18.0, 23.9};
+  const std::vector<double> kp = {0.0, 2.7, 5.0, 9.0};
+  const std::size_t slab = mlat.size() * mlt.size();
+  const std::size_t stride = slab + 3;  // padded slabs
+  const hwm14::Winds sentinel{-12345.0, -12345.0};
+  std::vector<hwm14::Winds> out((kp.size() - 1) * stride + slab, sentinel);
+
+  const auto n = model.DisturbanceWindsMagGrid(mlat, mlt, kp, out, stride);
+  if (!n || n.value() != slab * kp.size()) {
+    return false;
+  }
+  for (std::size_t k = 0; k < kp.size(); ++k) {
+    for (std::size_t i = 0; i < mlat.size(); ++i) {
+      for (std::size_t j = 0; j < mlt.size(); ++j) {
+        const auto ref = model.DisturbanceWindsMag(mlt[j], mlat[i], kp[k]);
+        const auto& got = out[k * stride + i * mlt.size() + j];
+        if (!ref || got.zonal_mps != ref.value().zonal_mps || got.meridional_mps != ref.value().meridional_mps) {
+          return false;
+        }
+      }
+    }
+    // Padding between slabs is untouched.
+    if (k + 1 < kp.size()) {
+      for (std::size_t p = slab; p < stride; ++p) {
+        if (out[k * stride + p].zonal_mps != sentinel.zonal_mps) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto model = hwm14::Model::LoadFromDirectory(dir);
+  hwm14::Options cached_opts{};
+  cached_opts.enable_cache = true;
+  auto cached = hwm14::Model::LoadFromDirectory(dir, cached_opts);
+  if (!model || !cached) {
+    return EXIT_FAILURE;
+  }
+  if (!GridMatchesPoints(model.value()) || !GridMatchesPoints(cached.value())) {
+    return EXIT_FAILURE;
+  }
+
+  const auto& m = model.value();
+  const std::vector<double> mlat = {10.0, 20.0};
+  const std::vector<double> mlt = {6.0};
+  const std::vector<double> kp = {1.0, 3.0};
+  std::vector<hwm14::Winds> out(4);
+
+  // Default stride packs slabs back to back.
+  if (!m.DisturbanceWindsMagGrid(mlat, mlt, kp, out)) {
+    return EXIT_FAILURE;
+  }
+  const auto last = m.DisturbanceWindsMag(6.0, 20.0, 3.0);
+  if (!last || out[3].zonal_mps != last.value().zonal_mps) {
+    return EXIT_FAILURE;
+  }
+
+  // Short buffers, short strides, and non-finite inputs are rejected.
+  std::vector<hwm14::Winds> small(3);
+  if (m.DisturbanceWindsMagGrid(mlat, mlt, kp, small)) {
+    return EXIT_FAILURE;
+  }
+  if (m.DisturbanceWindsMagGrid(mlat, mlt, kp, out, 1)) {
+    return EXIT_FAILURE;
+  }
+  const std::vector<double> bad_kp = {1.0, std::numeric_limits<double>::quiet_NaN()};
+  if (m.DisturbanceWindsMagGrid(mlat, mlt, bad_kp, out)) {
+    return EXIT_FAILURE;
+  }
+
+  // Quiet-only models have no disturbance tables.
+  hwm14::Options quiet_opts{};
+  quiet_opts.quiet_only = true;
+  auto quiet = hwm14::Model::LoadFromDirectory(dir, quiet_opts);
+  if (!quiet || quiet.value().DisturbanceWindsMagGrid(mlat, mlt, kp, out)) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -26,5 +26,14 @@ int main() {
     return 5;
   }
 
+  auto bad = d.value();
+  if (!hwm14::detail::DwmTermIndicesValid(bad)) {
+    return 6;
+  }
+  bad.termarr_flat[0] = hwm14::detail::DwmVshTermCount(bad.nmax, bad.mmax);
+  if (hwm14::detail::DwmTermIndicesValid(bad)) {
+    return 7;
+  }
+
   return 0;
 }
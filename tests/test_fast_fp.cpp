@@ -0,0 +1,50 @@
+// Author: watsonryan
+// Purpose: Bound the drift of the Options::strict_fp = false kernels from the strict path.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+
+#include "golden_scenarios.hpp"
+#include "hwm14/detail/fast_fp_kernels.hpp"
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+using hwm14::test::SweepInput;
+
+// Reassociated, fused reductions over a few hundred terms per level stay within this of strict.
+constexpr double kFastFpBoundMps = 1e-9;
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  hwm14::Options fast_opts{};
+  fast_opts.strict_fp = false;
+  auto strict = hwm14::Model::LoadFromDirectory(dir);
+  auto fast = hwm14::Model::LoadFromDirectory(dir, fast_opts);
+  if (!strict || !fast) {
+    return EXIT_FAILURE;
+  }
+  // The relaxed kernels are bound exactly when asked for and the CPU can run them.
+  if (strict.value().RelaxedFpKernels() || fast.value().RelaxedFpKernels() != hwm14::detail::fast_fp::Available()) {
+    return EXIT_FAILURE;
+  }
+
+  double drift = 0.0;
+  constexpr int kPoints = 4000;
+  for (int i = 0; i < kPoints; ++i) {
+    const auto in = SweepInput(i);
+    const auto a = strict.value().TotalWinds(in);
+    const auto b = fast.value().TotalWinds(in);
+    if (!a || !b) {
+      return EXIT_FAILURE;
+    }
+    const double dz = std::abs(a.value().zonal_mps - b.value().zonal_mps);
+    const double dm = std::abs(a.value().meridional_mps - b.value().meridional_mps);
+    drift = std::max({drift, dz, dm});
+  }
+  return drift <= kFastFpBoundMps ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,42 @@
+// Author: watsonryan
+// Purpose: Validate fixed-dimension ALF kernels are bit-identical to the generic recurrence.
+
+#include <cstdlib>
+#include <vector>
+
+#include "hwm14/detail/fixed_alf.hpp"
+#include "hwm14/detail/model_impl.hpp"
+
+namespace {
+
+template <typename Kernel>
+bool MatchesGeneric(const hwm14::detail::AlfState& alf) {
+  const auto kernel = Kernel::FromState(alf);
+  std::vector<double> gp;
+  std::vector<double> gv;
+  std::vector<double> gw;
+  std::vector<double> fp(Kernel::kSize, -1.0);
+  std::vector<double> fv(Kernel::kSize, -1.0);
+  std::vector<double> fw(Kernel::kSize, -1.0);
+  for (int i = 0; i <= 360; ++i) {
+    const double theta = 0.5 * static_cast<double>(i) * 3.14159265358979323846 / 180.0;
+    alf.Basis(Kernel::kNmax, Kernel::kMmax, theta, gp, gv, gw);
+    kernel.Basis(theta, fp.data(), fv.data(), fw.data());
+    if (gp != fp || gv != fv || gw != fw) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main() {
+  hwm14::detail::AlfState alf;
+  alf.Init(10, 4);
+  if (!MatchesGeneric<hwm14::detail::FixedAlf84>(alf) || !MatchesGeneric<hwm14::detail::FixedAlf103>(alf) ||
+      !MatchesGeneric<hwm14::detail::FixedAlf<5, 2>>(alf)) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
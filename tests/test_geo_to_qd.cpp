@@ -0,0 +1,106 @@
+// Author: watsonryan
+// Purpose: Validate the public geodetic-to-QD transform against the disturbance pipeline.
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+bool SameWinds(const hwm14::Winds& a, const hwm14::Winds& b) {
+  return a.zonal_mps == b.zonal_mps && a.meridional_mps == b.meridional_mps;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto loaded = hwm14::Model::LoadFromDirectory(dir);
+  if (!loaded) {
+    return EXIT_FAILURE;
+  }
+  const auto& model = loaded.value();
+
+  // Runs of rows at a shared epoch plus epoch changes, so the subsolar reuse is exercised both ways.
+  std::vector<hwm14::Inputs> batch;
+  for (int i = 0; i < 60; ++i) {
+    hwm14::Inputs in{};
+    in.yyddd = (i < 40) ? 95150 : 96010;
+    in.ut_seconds = 3600.0 * static_cast<double>(i / 10);
+    in.altitude_km = 110.0 + 5.0 * i;
+    in.geodetic_lat_deg = -89.0 + 3.0 * i;
+    in.geodetic_lon_deg = -180.0 + 6.1 * i;
+    in.ap3 = 30.0;
+    batch.push_back(in);
+  }
+
+  const std::size_t n = batch.size();
+  std::vector<double> qlat(n), qlon(n), mlt(n), f1e(n), f1n(n), f2e(n), f2n(n);
+  const hwm14::QdCoordinateColumns cols{qlat, qlon, mlt, f1e, f1n, f2e, f2n};
+  const auto rows = model.GeoToQdBatch(batch, cols);
+  if (!rows || rows.value() != n) {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<double> mlt_only(n);
+  hwm14::QdCoordinateColumns partial{};
+  partial.mlt_h = mlt_only;
+  if (!model.GeoToQdBatch(batch, partial)) {
+    return EXIT_FAILURE;
+  }
+
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto qd = model.GeoToQd(batch[i]);
+    if (!qd) {
+      return EXIT_FAILURE;
+    }
+    const auto& q = qd.value();
+    if (q.qlat_deg != qlat[i] || q.qlon_deg != qlon[i] || q.mlt_h != mlt[i] || q.mlt_h != mlt_only[i] ||
+        q.f1_east != f1e[i] || q.f1_north != f1n[i] || q.f2_east != f2e[i] || q.f2_north != f2n[i]) {
+      return EXIT_FAILURE;
+    }
+    if (std::abs(q.qlat_deg) > 90.0 || std::abs(q.qlon_deg) > 180.0) {
+      return EXIT_FAILURE;
+    }
+
+    // Reusing the caller's transform reproduces the self-contained disturbance evaluation.
+    const auto direct = model.DisturbanceWindsGeo(batch[i]);
+    const auto reused = model.DisturbanceWindsGeo(batch[i], q);
+    if (!direct || !reused || !SameWinds(direct.value(), reused.value())) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Short columns and invalid rows fail before any output is written.
+  std::vector<double> short_col(n - 1);
+  hwm14::QdCoordinateColumns short_cols{};
+  short_cols.qlat_deg = short_col;
+  if (model.GeoToQdBatch(batch, short_cols)) {
+    return EXIT_FAILURE;
+  }
+  auto bad = batch;
+  bad[n - 1].geodetic_lat_deg = 91.0;
+  std::vector<double> untouched(n, -1.0);
+  hwm14::QdCoordinateColumns bad_cols{};
+  bad_cols.qlat_deg = untouched;
+  if (model.GeoToQdBatch(bad, bad_cols) || untouched[0] != -1.0) {
+    return EXIT_FAILURE;
+  }
+  hwm14::QdCoordinates nan_qd{};
+  nan_qd.mlt_h = std::nan("");
+  if (model.DisturbanceWindsGeo(batch[0], nan_qd)) {
+    return EXIT_FAILURE;
+  }
+
+  hwm14::Options quiet_opts{};
+  quiet_opts.quiet_only = true;
+  auto quiet = hwm14::Model::LoadFromDirectory(dir, quiet_opts);
+  if (!quiet || quiet.value().GeoToQd(batch[0])) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
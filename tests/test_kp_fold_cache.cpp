@@ -0,0 +1,86 @@
+// Author: watsonryan
+// Purpose: Validate the per-Kp folded disturbance cache (Options::enable_cache) against the uncached path.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+// Folding reassociates the 300-term DWM sum; the drift stays at rounding level.
+constexpr double kFoldBoundMps = 1e-9;
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  hwm14::Options cached_opts{};
+  cached_opts.enable_cache = true;
+  auto plain = hwm14::Model::LoadFromDirectory(dir);
+  auto cached = hwm14::Model::LoadFromDirectory(dir, cached_opts);
+  auto cached_other = hwm14::Model::LoadFromDirectory(dir, cached_opts);
+  if (!plain || !cached || !cached_other) {
+    return EXIT_FAILURE;
+  }
+
+  // Cycle through more Kp values than the per-thread cache holds and alternate between two models, so
+  // hits, evictions, and per-model keys are all exercised.
+  double drift = 0.0;
+  for (int i = 0; i < 6000; ++i) {
+    const double kp = 0.5 * (i % 17);
+    const double mlt = 0.2 * (i % 120);
+    const double mlat = -89.0 + 0.03 * (i % 5934);
+    const auto& model = (i % 3 == 0) ? cached_other.value() : cached.value();
+    const auto a = plain.value().DisturbanceWindsMag(mlt, mlat, kp);
+    const auto b = model.DisturbanceWindsMag(mlt, mlat, kp);
+    if (!a || !b) {
+      return EXIT_FAILURE;
+    }
+    drift = std::max({drift, std::abs(a.value().zonal_mps - b.value().zonal_mps),
+                      std::abs(a.value().meridional_mps - b.value().meridional_mps)});
+  }
+
+  // Geographic evaluations fold by the Kp derived from ap3.
+  hwm14::Inputs in{};
+  in.yyddd = 95280;
+  in.ut_seconds = 21.0 * 3600.0;
+  in.altitude_km = 350.0;
+  in.geodetic_lat_deg = 38.0;
+  in.geodetic_lon_deg = 125.0;
+  for (const double ap3 : {4.0, 48.0, 48.0, 207.0}) {
+    in.ap3 = ap3;
+    const auto a = plain.value().DisturbanceWindsGeo(in);
+    const auto b = cached.value().DisturbanceWindsGeo(in);
+    if (!a || !b) {
+      return EXIT_FAILURE;
+    }
+    drift = std::max({drift, std::abs(a.value().zonal_mps - b.value().zonal_mps),
+                      std::abs(a.value().meridional_mps - b.value().meridional_mps)});
+  }
+
+  // Grid requests with more Kp values than the point cache holds match folded point calls exactly.
+  const std::vector<double> mlats{-60.0, -20.0, 15.0, 55.0};
+  const std::vector<double> mlts{0.0, 5.5, 11.0, 17.5};
+  const std::vector<double> kps{0.0, 1.5, 3.0, 4.5, 6.0, 7.5};
+  std::vector<hwm14::Winds> grid(kps.size() * mlats.size() * mlts.size());
+  if (!cached.value().DisturbanceWindsMagGrid(mlats, mlts, kps, grid)) {
+    return EXIT_FAILURE;
+  }
+  for (std::size_t k = 0; k < kps.size(); ++k) {
+    for (std::size_t i = 0; i < mlats.size(); ++i) {
+      for (std::size_t j = 0; j < mlts.size(); ++j) {
+        const auto w = cached.value().DisturbanceWindsMag(mlts[j], mlats[i], kps[k]);
+        const auto& g = grid[(k * mlats.size() + i) * mlts.size() + j];
+        if (!w || w.value().zonal_mps != g.zonal_mps || w.value().meridional_mps != g.meridional_mps) {
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  return drift <= kFoldBoundMps ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,90 @@
+// Author: watsonryan
+// Purpose: Validate lazy and quiet-only disturbance loading, including concurrent first use.
+
+#include <cstdlib>
+#include <filesystem>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "golden_scenarios.hpp"
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+using hwm14::test::SweepInput;
+
+bool SameWinds(const hwm14::Result<hwm14::Winds, hwm14::Error>& a, const hwm14::Result<hwm14::Winds, hwm14::Error>& b) {
+  return a && b && a.value().meridional_mps == b.value().meridional_mps && a.value().zonal_mps == b.value().zonal_mps;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto eager = hwm14::Model::LoadFromDirectory(dir);
+  hwm14::Options lazy_opts{};
+  lazy_opts.lazy_disturbance = true;
+  auto lazy = hwm14::Model::LoadFromDirectory(dir, lazy_opts);
+  if (!eager || !lazy) {
+    return EXIT_FAILURE;
+  }
+
+  // Several threads race to trigger the deferred load; all must see identical results.
+  constexpr int kThreads = 4;
+  std::vector<int> ok(kThreads, 0);
+  std::vector<std::thread> pool;
+  for (int t = 0; t < kThreads; ++t) {
+    pool.emplace_back([&, t] {
+      bool all = true;
+      for (int i = 0; i < 12; ++i) {
+        all = all && SameWinds(lazy.value().TotalWinds(SweepInput(i)), eager.value().TotalWinds(SweepInput(i)));
+      }
+      ok[static_cast<std::size_t>(t)] = all ? 1 : 0;
+    });
+  }
+  for (auto& th : pool) {
+    th.join();
+  }
+  for (const int v : ok) {
+    if (v != 1) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  hwm14::Options quiet_opts{};
+  quiet_opts.quiet_only = true;
+  auto quiet = hwm14::Model::LoadFromDirectory(dir, quiet_opts);
+  if (!quiet) {
+    return EXIT_FAILURE;
+  }
+  auto in = SweepInput(3);
+  if (!SameWinds(quiet.value().QuietWinds(in), eager.value().QuietWinds(in))) {
+    return EXIT_FAILURE;
+  }
+  const auto disturbed = quiet.value().TotalWinds(in);
+  if (disturbed || disturbed.error().code != hwm14::ErrorCode::kInvalidInput) {
+    return EXIT_FAILURE;
+  }
+  in.ap3 = -1.0;
+  if (!SameWinds(quiet.value().TotalWinds(in), eager.value().TotalWinds(in))) {
+    return EXIT_FAILURE;
+  }
+
+  // A deferred load that fails reports the error on every disturbance call.
+  const auto tmp = std::filesystem::temp_directory_path() / "hwm14_lazy_disturbance_test";
+  std::error_code ec;
+  std::filesystem::remove_all(tmp, ec);
+  std::filesystem::create_directories(tmp);
+  for (const char* f : {"hwm123114.bin", "dwm07b104i.dat", "gd2qd.dat"}) {
+    std::filesystem::copy_file(dir / f, tmp / f);
+  }
+  auto broken = hwm14::Model::LoadFromDirectory(tmp, lazy_opts);
+  std::filesystem::remove(tmp / "dwm07b104i.dat");
+  const bool loaded = static_cast<bool>(broken);
+  const bool fails_twice =
+      loaded && !broken.value().TotalWinds(SweepInput(1)) && !broken.value().TotalWinds(SweepInput(2));
+  const bool quiet_still_ok = loaded && static_cast<bool>(broken.value().QuietWinds(SweepInput(1)));
+  std::filesystem::remove_all(tmp, ec);
+  return fails_twice && quiet_still_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
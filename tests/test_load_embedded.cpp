@@ -0,0 +1,36 @@
+// Author: watsonryan
+// Purpose: Validate embedded-data loading matches directory loading, or reports kNotImplemented when disabled.
+
+#include <cstdlib>
+#include <filesystem>
+
+#include "hwm14/hwm14.hpp"
+
+int main() {
+  auto embedded = hwm14::Model::LoadEmbedded();
+  if (!embedded) {
+    return embedded.error().code == hwm14::ErrorCode::kNotImplemented ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto from_dir = hwm14::Model::LoadFromDirectory(dir);
+  if (!from_dir) {
+    return EXIT_FAILURE;
+  }
+
+  for (int i = 0; i < 16; ++i) {
+    hwm14::Inputs in{};
+    in.yyddd = 95020 + i * 20;
+    in.ut_seconds = 5000.0 * i;
+    in.altitude_km = 30.0 + 30.0 * i;
+    in.geodetic_lat_deg = -75.0 + 10.0 * i;
+    in.geodetic_lon_deg = -160.0 + 20.0 * i;
+    in.ap3 = 10.0 * i;
+    const auto a = from_dir.value().TotalWinds(in);
+    const auto b = embedded.value().TotalWinds(in);
+    if (!a || !b || a.value().meridional_mps != b.value().meridional_mps || a.value().zonal_mps != b.value().zonal_mps) {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+// Author: watsonryan
+// Purpose: Validate in-memory model loading matches directory loading and rejects bad buffers.
+
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+std::vector<std::byte> ReadBytes(const std::filesystem::path& p) {
+  std::ifstream in(p, std::ios::binary);
+  const std::vector<char> raw((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  std::vector<std::byte> out(raw.size());
+  for (std::size_t i = 0; i < raw.size(); ++i) {
+    out[i] = static_cast<std::byte>(raw[i]);
+  }
+  return out;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto from_dir = hwm14::Model::LoadFromDirectory(dir);
+  if (!from_dir) {
+    return EXIT_FAILURE;
+  }
+
+  const auto hwm = ReadBytes(dir / "hwm123114.bin");
+  const auto dwm = ReadBytes(dir / "dwm07b104i.dat");
+  const auto gd2qd = ReadBytes(dir / "gd2qd.dat");
+
+  // Parse from deliberately misaligned copies to exercise unaligned record views.
+  std::vector<std::byte> shifted(hwm.size() + 1);
+  std::copy(hwm.begin(), hwm.end(), shifted.begin() + 1);
+  const std::span<const std::byte> hwm_view = std::span<const std::byte>(shifted).subspan(1);
+
+  auto from_mem = hwm14::Model::LoadFromMemory(hwm_view, dwm, gd2qd);
+  if (!from_mem) {
+    return EXIT_FAILURE;
+  }
+
+  for (int i = 0; i < 16; ++i) {
+    hwm14::Inputs in{};
+    in.yyddd = 95020 + i * 20;
+    in.ut_seconds = 5000.0 * i;
+    in.altitude_km = 30.0 + 30.0 * i;
+    in.geodetic_lat_deg = -75.0 + 10.0 * i;
+    in.geodetic_lon_deg = -160.0 + 20.0 * i;
+    in.ap3 = 10.0 * i;
+    const auto a = from_dir.value().TotalWinds(in);
+    const auto b = from_mem.value().TotalWinds(in);
+    if (!a || !b || a.value().meridional_mps != b.value().meridional_mps || a.value().zonal_mps != b.value().zonal_mps) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  const auto truncated = hwm14::Model::LoadFromMemory(hwm, std::span<const std::byte>(dwm).first(dwm.size() - 9), gd2qd);
+  if (truncated || truncated.error().code != hwm14::ErrorCode::kDataFileParseFailed) {
+    return EXIT_FAILURE;
+  }
+  const auto empty = hwm14::Model::LoadFromMemory({}, dwm, gd2qd);
+  if (empty || empty.error().code != hwm14::ErrorCode::kDataFileParseFailed) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+// Author: watsonryan
+// Purpose: Validate precompiled blob round-trip, bit-identical evaluation, and corruption checks.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+bool SameWinds(const hwm14::Model& a, const hwm14::Model& b, const hwm14::Inputs& in) {
+  const auto wa = a.TotalWinds(in);
+  const auto wb = b.TotalWinds(in);
+  return wa && wb && wa.value().meridional_mps == wb.value().meridional_mps &&
+         wa.value().zonal_mps == wb.value().zonal_mps;
+}
+
+// Byte offset of blob section `id` (0 if absent): the section table follows the 64-byte header, whose
+// section count is at byte 32, and each 32-byte entry starts with {u32 id, u32 elem_size, u64 offset}.
+std::size_t SectionOffset(const std::vector<char>& bytes, std::uint32_t id) {
+  std::uint32_t sections = 0;
+  std::memcpy(&sections, bytes.data() + 32, sizeof(sections));
+  for (std::uint32_t i = 0; i < sections; ++i) {
+    const char* entry = bytes.data() + 64 + 32 * static_cast<std::size_t>(i);
+    std::uint32_t entry_id = 0;
+    std::uint64_t offset = 0;
+    std::memcpy(&entry_id, entry, sizeof(entry_id));
+    std::memcpy(&offset, entry + 8, sizeof(offset));
+    if (entry_id == id) {
+      return static_cast<std::size_t>(offset);
+    }
+  }
+  return 0;
+}
+
+}  // namespace
+
+int main() {
+  auto model = hwm14::Model::LoadFromDirectory(std::filesystem::path(HWM14_SOURCE_DIR) / "testdata");
+  if (!model) {
+    return EXIT_FAILURE;
+  }
+
+  const auto tmp = std::filesystem::temp_directory_path() / "hwm14_model_blob";
+  std::error_code ec;
+  std::filesystem::remove_all(tmp, ec);
+  std::filesystem::create_directories(tmp, ec);
+  if (ec) {
+    return EXIT_FAILURE;
+  }
+
+  const auto blob_path = tmp / "model.blob";
+  const auto written = model.value().SaveBlob(blob_path);
+  if (!written || written.value() != std::filesystem::file_size(blob_path)) {
+    return EXIT_FAILURE;
+  }
+
+  auto blob = hwm14::Model::LoadFromBlob(blob_path);
+  if (!blob) {
+    return EXIT_FAILURE;
+  }
+
+  for (int i = 0; i < 24; ++i) {
+    hwm14::Inputs in{};
+    in.yyddd = 95001 + i * 15;
+    in.ut_seconds = 3600.0 * i;
+    in.altitude_km = 10.0 + 40.0 * i;
+    in.geodetic_lat_deg = -88.0 + 7.5 * i;
+    in.geodetic_lon_deg = -175.0 + 15.0 * i;
+    in.ap3 = 4.0 * i;
+    if (!SameWinds(model.value(), blob.value(), in)) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::vector<char> bytes;
+  {
+    std::ifstream in(blob_path, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+
+  // Flip one payload byte: checksum must catch it, and skipping verification must not.
+  {
+    auto corrupt = bytes;
+    corrupt[corrupt.size() / 2] = static_cast<char>(corrupt[corrupt.size() / 2] ^ 0x5A);
+    std::ofstream out(tmp / "corrupt.blob", std::ios::binary);
+    out.write(corrupt.data(), static_cast<std::streamsize>(corrupt.size()));
+  }
+  const auto corrupt = hwm14::Model::LoadFromBlob(tmp / "corrupt.blob");
+  if (corrupt || corrupt.error().code != hwm14::ErrorCode::kDataFileParseFailed) {
+    return EXIT_FAILURE;
+  }
+  hwm14::Options trusted{};
+  trusted.verify_blob_checksum = false;
+  if (!hwm14::Model::LoadFromBlob(tmp / "corrupt.blob", trusted)) {
+    return EXIT_FAILURE;
+  }
+
+  // An order table entry past the harmonic tables is rejected even without checksum verification.
+  {
+    constexpr std::uint32_t kOrderSection = 5;
+    auto bad_order = bytes;
+    const std::size_t at = SectionOffset(bad_order, kOrderSection);
+    const std::int32_t amaxs = 1000;
+    if (at == 0) {
+      return EXIT_FAILURE;
+    }
+    std::memcpy(bad_order.data() + at, &amaxs, sizeof(amaxs));
+    std::ofstream out(tmp / "bad_order.blob", std::ios::binary);
+    out.write(bad_order.data(), static_cast<std::streamsize>(bad_order.size()));
+  }
+  const auto bad_order = hwm14::Model::LoadFromBlob(tmp / "bad_order.blob", trusted);
+  if (bad_order || bad_order.error().code != hwm14::ErrorCode::kDataFileParseFailed) {
+    return EXIT_FAILURE;
+  }
+
+  // Unknown version and truncation are rejected.
+  {
+    auto future = bytes;
+    future[8] = static_cast<char>(future[8] + 1);
+    std::ofstream out(tmp / "future.blob", std::ios::binary);
+    out.write(future.data(), static_cast<std::streamsize>(future.size()));
+  }
+  if (hwm14::Model::LoadFromBlob(tmp / "future.blob")) {
+    return EXIT_FAILURE;
+  }
+  {
+    std::ofstream out(tmp / "short.blob", std::ios::binary);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size() / 3));
+  }
+  if (hwm14::Model::LoadFromBlob(tmp / "short.blob", trusted)) {
+    return EXIT_FAILURE;
+  }
+  if (hwm14::Model::LoadFromBlob(tmp / "missing.blob")) {
+    return EXIT_FAILURE;
+  }
+
+  std::filesystem::remove_all(tmp, ec);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+// Author: watsonryan
+// Purpose: Stress ModelHandle reloads against concurrent lock-free readers (run under HWM14_SANITIZER=thread).
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+#include "golden_scenarios.hpp"
+#include "hwm14/model_handle.hpp"
+
+using hwm14::test::SweepInput;
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto initial = hwm14::Model::LoadFromDirectory(dir);
+  if (!initial) {
+    return EXIT_FAILURE;
+  }
+  constexpr int kBatch = 16;
+  std::vector<hwm14::Winds> want;
+  for (int i = 0; i < kBatch; ++i) {
+    const auto w = initial.value().TotalWinds(SweepInput(i));
+    if (!w) {
+      return EXIT_FAILURE;
+    }
+    want.push_back(w.value());
+  }
+
+  hwm14::ModelHandle handle(initial.value());
+  const auto pinned = handle.Snapshot();
+
+  constexpr int kReaders = 3;
+  constexpr int kReloads = 12;
+  std::atomic<bool> done{false};
+  std::atomic<int> failures{0};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < kReaders; ++r) {
+    readers.emplace_back([&] {
+      std::uint64_t last_gen = 0;
+      do {
+        const std::uint64_t gen = handle.Generation();
+        const auto snap = handle.Snapshot();
+        for (int i = 0; i < kBatch; ++i) {
+          const auto w = snap->TotalWinds(SweepInput(i));
+          if (!w || w.value().zonal_mps != want[static_cast<std::size_t>(i)].zonal_mps ||
+              w.value().meridional_mps != want[static_cast<std::size_t>(i)].meridional_mps) {
+            failures.fetch_add(1);
+          }
+        }
+        if (gen < last_gen) {
+          failures.fetch_add(1);
+        }
+        last_gen = gen;
+      } while (!done.load());
+    });
+  }
+
+  for (int k = 0; k < kReloads; ++k) {
+    const auto gen = (k % 2 == 0) ? handle.Reload(dir) : handle.ReloadAsync(dir).get();
+    if (!gen || gen.value() != static_cast<std::uint64_t>(k + 1)) {
+      failures.fetch_add(1);
+    }
+  }
+  // A failed reload keeps the current snapshot.
+  const auto before = handle.Snapshot();
+  if (handle.Reload(dir / "missing") || handle.Snapshot() != before) {
+    failures.fetch_add(1);
+  }
+  done.store(true);
+  for (auto& t : readers) {
+    t.join();
+  }
+
+  // The snapshot taken before any reload still evaluates after its state was replaced.
+  const auto w = pinned->TotalWinds(SweepInput(0));
+  if (!w || w.value().zonal_mps != want[0].zonal_mps || handle.Generation() != kReloads) {
+    return EXIT_FAILURE;
+  }
+  return failures.load() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
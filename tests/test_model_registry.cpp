@@ -0,0 +1,109 @@
+// Author: watsonryan
+// Purpose: Validate the process-wide interned model cache: sharing, option keys, staleness, eviction.
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+// Models sharing interned state share the quiet coefficient storage.
+const double* StateOf(const hwm14::Model& m) {
+  return m.QuietZonalCoefficients().data();
+}
+
+}  // namespace
+
+int main() {
+  const auto src = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  const auto dir = std::filesystem::temp_directory_path() / "hwm14_model_registry_test";
+  std::error_code ec;
+  std::filesystem::remove_all(dir, ec);
+  std::filesystem::create_directories(dir);
+  for (const char* name : {"hwm123114.bin", "dwm07b104i.dat", "gd2qd.dat"}) {
+    std::filesystem::copy_file(src / name, dir / name);
+  }
+
+  hwm14::Model::EvictInterned();
+  auto a = hwm14::Model::LoadInterned(dir);
+  auto b = hwm14::Model::LoadInterned(dir / ".." / dir.filename());
+  if (!a || !b || StateOf(a.value()) != StateOf(b.value()) || hwm14::Model::InternedCount() != 1) {
+    return EXIT_FAILURE;
+  }
+
+  // Options that change the derived state get their own entry.
+  hwm14::Options quiet{};
+  quiet.quiet_only = true;
+  auto q = hwm14::Model::LoadInterned(dir, quiet);
+  if (!q || StateOf(q.value()) == StateOf(a.value()) || hwm14::Model::InternedCount() != 2) {
+    return EXIT_FAILURE;
+  }
+
+  // Concurrent loads of the same key all observe one state.
+  std::vector<const double*> seen(4, nullptr);
+  std::vector<std::thread> pool;
+  for (std::size_t t = 0; t < seen.size(); ++t) {
+    pool.emplace_back([&, t] {
+      auto m = hwm14::Model::LoadInterned(dir);
+      seen[t] = m ? StateOf(m.value()) : nullptr;
+    });
+  }
+  for (auto& th : pool) {
+    th.join();
+  }
+  for (const double* p : seen) {
+    if (p != StateOf(a.value())) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // A touched file replaces the stale entry; models already handed out keep working.
+  const auto bin = dir / "hwm123114.bin";
+  std::filesystem::last_write_time(bin, std::filesystem::last_write_time(bin) + std::chrono::seconds(5));
+  auto c = hwm14::Model::LoadInterned(dir);
+  if (!c || StateOf(c.value()) == StateOf(a.value()) || hwm14::Model::InternedCount() != 2) {
+    return EXIT_FAILURE;
+  }
+  hwm14::Inputs in{};
+  in.yyddd = 95150;
+  in.altitude_km = 250.0;
+  in.ap3 = 80.0;
+  const auto wa = a.value().TotalWinds(in);
+  const auto wc = c.value().TotalWinds(in);
+  if (!wa || !wc || wa.value().zonal_mps != wc.value().zonal_mps) {
+    return EXIT_FAILURE;
+  }
+
+  // Lazily read disturbance files must still match the identity the entry was keyed on.
+  hwm14::Options lazy{};
+  lazy.lazy_disturbance = true;
+  auto l = hwm14::Model::LoadInterned(dir, lazy);
+  if (!l) {
+    return EXIT_FAILURE;
+  }
+  const auto dwm = dir / "dwm07b104i.dat";
+  std::filesystem::last_write_time(dwm, std::filesystem::last_write_time(dwm) + std::chrono::seconds(5));
+  const auto changed = l.value().DisturbanceWindsMag(12.0, 60.0, 3.0);
+  auto relazy = hwm14::Model::LoadInterned(dir, lazy);
+  if (changed || changed.error().code != hwm14::ErrorCode::kDataFileOpenFailed || !relazy ||
+      !relazy.value().DisturbanceWindsMag(12.0, 60.0, 3.0) || hwm14::Model::InternedCount() != 3) {
+    return EXIT_FAILURE;
+  }
+
+  if (hwm14::Model::EvictInterned(src) != 0 || hwm14::Model::EvictInterned(dir) != 3 ||
+      hwm14::Model::InternedCount() != 0) {
+    return EXIT_FAILURE;
+  }
+  if (hwm14::Model::LoadInterned(dir / "missing")) {
+    return EXIT_FAILURE;
+  }
+
+  std::filesystem::remove_all(dir, ec);
+  return EXIT_SUCCESS;
+}
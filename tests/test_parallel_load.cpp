@@ -0,0 +1,46 @@
+// Author: watsonryan
+// Purpose: Validate the parallel load path produces a model identical to the serial path.
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+
+#include "hwm14/hwm14.hpp"
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  hwm14::Options parallel{};
+  parallel.parallel_load = true;
+  auto serial_model = hwm14::Model::LoadFromDirectory(dir);
+  auto parallel_model = hwm14::Model::LoadFromDirectory(dir, parallel);
+  if (!serial_model || !parallel_model) {
+    return EXIT_FAILURE;
+  }
+
+  const auto a = serial_model.value().QuietMeridionalCoefficients();
+  const auto b = parallel_model.value().QuietMeridionalCoefficients();
+  const auto c = serial_model.value().QuietZonalCoefficients();
+  const auto d = parallel_model.value().QuietZonalCoefficients();
+  if (!std::equal(a.begin(), a.end(), b.begin(), b.end()) || !std::equal(c.begin(), c.end(), d.begin(), d.end())) {
+    return EXIT_FAILURE;
+  }
+
+  for (int i = 0; i < 12; ++i) {
+    hwm14::Inputs in{};
+    in.yyddd = 95040 + i * 25;
+    in.ut_seconds = 7000.0 * i;
+    in.altitude_km = 80.0 + 25.0 * i;
+    in.geodetic_lat_deg = -66.0 + 12.0 * i;
+    in.geodetic_lon_deg = -170.0 + 29.0 * i;
+    in.ap3 = 15.0 * i;
+    const auto x = serial_model.value().TotalWinds(in);
+    const auto y = parallel_model.value().TotalWinds(in);
+    if (!x || !y || x.value().meridional_mps != y.value().meridional_mps || x.value().zonal_mps != y.value().zonal_mps) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // A missing file must still surface as an error, not a hang or crash.
+  auto missing = hwm14::Model::LoadFromDirectory(dir / "does_not_exist", parallel);
+  return missing ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+// Author: watsonryan
+// Purpose: Validate the interpolated QD lookup grid (Options::qd_grid_step_deg) against the exact transform.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+// Observed at a 2 degree spacing: qlat 1.9e-4 deg, qlon arc 1.3e-4 deg, f1/f2 4.1e-5; the bounds leave
+// headroom.
+constexpr double kQlatBoundDeg = 5e-4;
+constexpr double kFBound = 1e-4;
+constexpr double kWindBoundMps = 1e-2;
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  hwm14::Options grid_opts{};
+  grid_opts.qd_grid_step_deg = 2.0;
+  auto exact = hwm14::Model::LoadFromDirectory(dir);
+  auto grid = hwm14::Model::LoadFromDirectory(dir, grid_opts);
+  grid_opts.lazy_disturbance = true;
+  auto lazy = hwm14::Model::LoadFromDirectory(dir, grid_opts);
+  if (!exact || !grid || !lazy) {
+    return EXIT_FAILURE;
+  }
+
+  const auto report = grid.value().ValidateQdGrid();
+  if (!report || report.value().samples == 0 || report.value().max_qlat_err_deg > kQlatBoundDeg ||
+      report.value().max_qlon_arc_err_deg > kQlatBoundDeg || report.value().max_f_err > kFBound) {
+    return EXIT_FAILURE;
+  }
+
+  // Off-node points including both poles and the longitude seam; the lazy model builds the same grid
+  // on first use.
+  double wind_err = 0.0;
+  hwm14::Inputs in{};
+  in.yyddd = 95150;
+  in.altitude_km = 250.0;
+  in.ap3 = 80.0;
+  for (int i = 0; i < 4000; ++i) {
+    in.ut_seconds = 21.6 * i;
+    in.geodetic_lat_deg = std::clamp(-90.0 + 0.0451 * i, -90.0, 90.0);
+    in.geodetic_lon_deg = (i % 2 == 0) ? 179.9 + 0.013 * (i % 20) : -540.0 + 0.2713 * i;
+    const auto a = exact.value().GeoToQd(in);
+    const auto b = grid.value().GeoToQd(in);
+    const auto c = lazy.value().GeoToQd(in);
+    if (!a || !b || !c || b.value().qlat_deg != c.value().qlat_deg || b.value().f1_east != c.value().f1_east) {
+      return EXIT_FAILURE;
+    }
+    const auto& qa = a.value();
+    const auto& qb = b.value();
+    if (std::abs(qa.qlat_deg - qb.qlat_deg) > kQlatBoundDeg || std::abs(qa.f1_east - qb.f1_east) > kFBound ||
+        std::abs(qa.f1_north - qb.f1_north) > kFBound || std::abs(qa.f2_east - qb.f2_east) > kFBound ||
+        std::abs(qa.f2_north - qb.f2_north) > kFBound) {
+      return EXIT_FAILURE;
+    }
+    const auto wa = exact.value().DisturbanceWindsGeo(in);
+    const auto wb = grid.value().DisturbanceWindsGeo(in);
+    if (!wa || !wb) {
+      return EXIT_FAILURE;
+    }
+    wind_err = std::max({wind_err, std::abs(wa.value().zonal_mps - wb.value().zonal_mps),
+                         std::abs(wa.value().meridional_mps - wb.value().meridional_mps)});
+  }
+  if (wind_err > kWindBoundMps) {
+    return EXIT_FAILURE;
+  }
+
+  // Exact models have nothing to validate; spacings must divide 180 within [0.25, 30].
+  if (exact.value().ValidateQdGrid()) {
+    return EXIT_FAILURE;
+  }
+  for (const double step : {-1.0, 0.1, 7.0, 45.0, std::nan("")}) {
+    hwm14::Options bad{};
+    bad.qd_grid_step_deg = step;
+    if (hwm14::Model::LoadFromDirectory(dir, bad)) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+// Author: watsonryan
+// Purpose: Validate quiet-wind design-matrix export reproduces QuietWinds.
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+int main() {
+  auto model = hwm14::Model::LoadFromDirectory(std::filesystem::path(HWM14_SOURCE_DIR) / "testdata");
+  if (!model) {
+    return EXIT_FAILURE;
+  }
+  const auto& m = model.value();
+
+  std::vector<hwm14::Inputs> batch;
+  for (int i = 0; i < 12; ++i) {
+    hwm14::Inputs x{};
+    x.yyddd = 95001 + (i * 29) % 365;
+    x.ut_seconds = (i * 7211) % 86400;
+    x.altitude_km = 20.0 + 45.0 * i;
+    x.geodetic_lat_deg = -85.0 + 15.0 * i;
+    x.geodetic_lon_deg = -170.0 + 31.0 * i;
+    x.ap3 = -1.0;
+    batch.push_back(x);
+  }
+
+  // Build in two chunks to exercise the append path.
+  hwm14::SparseDesignMatrix sparse;
+  const std::span<const hwm14::Inputs> all(batch);
+  if (!m.AppendQuietDesignRows(all.first(5), sparse) || !m.AppendQuietDesignRows(all.subspan(5), sparse)) {
+    return EXIT_FAILURE;
+  }
+  if (sparse.row_ptr.size() != batch.size() + 1 || sparse.row_ptr.back() != sparse.entries.size()) {
+    return EXIT_FAILURE;
+  }
+
+  const std::size_t ncol = m.QuietDesignColumns();
+  std::vector<double> dense(batch.size() * ncol, -1.0);
+  const auto rows = m.QuietDesignMatrixDense(batch, dense);
+  if (!rows || rows.value() != batch.size()) {
+    return EXIT_FAILURE;
+  }
+
+  const auto mparm = m.QuietZonalCoefficients();
+  const auto tparm = m.QuietMeridionalCoefficients();
+  const std::size_t nbf = m.QuietTermsPerLevel();
+  if (nbf == 0 || ncol % nbf != 0 || mparm.size() != ncol || tparm.size() != ncol) {
+    return EXIT_FAILURE;
+  }
+
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    const auto q = m.QuietWinds(batch[i]);
+    if (!q) {
+      return EXIT_FAILURE;
+    }
+
+    double u_sparse = 0.0;
+    double v_sparse = 0.0;
+    for (std::size_t e = sparse.row_ptr[i]; e < sparse.row_ptr[i + 1]; ++e) {
+      const auto& entry = sparse.entries[e];
+      const std::size_t col = static_cast<std::size_t>(entry.level) * nbf + static_cast<std::size_t>(entry.offset);
+      u_sparse += entry.value * mparm[col];
+      v_sparse += entry.value * tparm[col];
+      if (dense[i * ncol + col] != entry.value) {
+        return EXIT_FAILURE;
+      }
+    }
+
+    double u_dense = 0.0;
+    double v_dense = 0.0;
+    for (std::size_t j = 0; j < ncol; ++j) {
+      u_dense += dense[i * ncol + j] * mparm[j];
+      v_dense += dense[i * ncol + j] * tparm[j];
+    }
+
+    const double tol = 1e-9 * (1.0 + std::abs(q.value().zonal_mps) + std::abs(q.value().meridional_mps));
+    if (std::abs(u_sparse - q.value().zonal_mps) > tol || std::abs(v_sparse - q.value().meridional_mps) > tol ||
+        std::abs(u_dense - q.value().zonal_mps) > tol || std::abs(v_dense - q.value().meridional_mps) > tol) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::vector<double> small(ncol);
+  const auto too_small = m.QuietDesignMatrixDense(batch, small);
+  if (too_small || too_small.error().code != hwm14::ErrorCode::kInvalidInput) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+// Author: watsonryan
+// Purpose: Validate shared-basis ensemble evaluation against per-member QuietWinds.
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "hwm14/detail/hwm_bin_loader.hpp"
+#include "hwm14/hwm14.hpp"
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto model = hwm14::Model::LoadFromDirectory(dir);
+  auto raw = hwm14::detail::LoadHwmBinHeader(dir / "hwm123114.bin");
+  if (!model || !raw) {
+    return EXIT_FAILURE;
+  }
+  if (model.value().EnsembleSize() != 0) {
+    return EXIT_FAILURE;
+  }
+
+  auto doubled = raw.value().mparm;
+  for (auto& x : doubled) {
+    x *= 2.0;
+  }
+  auto ens = model.value().WithEnsembleMembers({raw.value().mparm, doubled});
+  if (!ens) {
+    return EXIT_FAILURE;
+  }
+  const std::vector<std::filesystem::path> files = {dir / "hwm123114.bin"};
+  auto ens3 = ens.value().WithEnsembleMembersFromFiles(files);
+  if (!ens3 || ens3.value().EnsembleSize() != 3) {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<hwm14::Inputs> batch;
+  for (int i = 0; i < 10; ++i) {
+    hwm14::Inputs x{};
+    x.yyddd = 95010 + i * 33;
+    x.ut_seconds = 3600.0 * i;
+    x.altitude_km = 50.0 + 50.0 * i;
+    x.geodetic_lat_deg = -70.0 + 14.0 * i;
+    x.geodetic_lon_deg = -150.0 + 30.0 * i;
+    x.ap3 = -1.0;
+    batch.push_back(x);
+  }
+
+  std::vector<hwm14::Winds> out(batch.size() * 3);
+  const auto n = ens3.value().QuietWindsEnsemble(batch, out);
+  if (!n || n.value() != batch.size()) {
+    return EXIT_FAILURE;
+  }
+
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    const auto q = model.value().QuietWinds(batch[i]);
+    if (!q) {
+      return EXIT_FAILURE;
+    }
+    const auto& m0 = out[i * 3];
+    const auto& m1 = out[i * 3 + 1];
+    const auto& m2 = out[i * 3 + 2];
+    if (m0.zonal_mps != q.value().zonal_mps || m0.meridional_mps != q.value().meridional_mps) {
+      return EXIT_FAILURE;
+    }
+    if (m1.zonal_mps != 2.0 * q.value().zonal_mps || m1.meridional_mps != 2.0 * q.value().meridional_mps) {
+      return EXIT_FAILURE;
+    }
+    if (m2.zonal_mps != q.value().zonal_mps || m2.meridional_mps != q.value().meridional_mps) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  const auto bad = model.value().WithEnsembleMembers({std::vector<double>(7, 0.0)});
+  if (bad || bad.error().code != hwm14::ErrorCode::kInvalidInput) {
+    return EXIT_FAILURE;
+  }
+  std::vector<hwm14::Winds> none(batch.size());
+  if (model.value().QuietWindsEnsemble(batch, none)) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,149 @@
+// Author: watsonryan
+// Purpose: Validate generated quiet-wind level kernels against a loop-nest reference of the basis row.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "hwm14/detail/model_impl.hpp"
+#include "hwm14/detail/quiet_level_kernels.hpp"
+
+namespace {
+
+using hwm14::detail::HwmBinHeader;
+using hwm14::detail::QuietLevelArgs;
+
+// Straight transcription of the order-table loops (wave/tide factors are 1 for m, l >= 1).
+int ReferenceRow(const HwmBinHeader& h, int maxo, int d, const QuietLevelArgs& a, std::vector<double>& bz) {
+  const auto ord = [&](int c0) { return h.order[static_cast<std::size_t>(c0 + h.ncomp * d)]; };
+  const auto gi = [maxo](int n, int m) { return static_cast<std::size_t>(n * (maxo + 1) + m); };
+  std::size_t c = 0;
+  for (int n = 1; n <= ord(1); ++n) {
+    const double sc = a.sn[n];
+    bz[c++] = -sc;
+    bz[c++] = sc;
+  }
+  for (int s = 1; s <= ord(0); ++s) {
+    for (int n = 1; n <= ord(1); ++n) {
+      const double sc = a.sn[n];
+      bz[c++] = -sc * a.fs[2 * s];
+      bz[c++] = sc * a.fs[2 * s + 1];
+      bz[c++] = sc * a.fs[2 * s];
+      bz[c++] = -sc * a.fs[2 * s + 1];
+    }
+  }
+  const auto block = [&](int mx, int sx, int nx, const double* f) {
+    for (int m = 1; m <= mx; ++m) {
+      const double cm = f[2 * m];
+      const double sm = f[2 * m + 1];
+      for (int n = m; n <= nx; ++n) {
+        const double vb = a.gv[gi(n, m)];
+        const double wb = a.gw[gi(n, m)];
+        bz[c++] = -vb * cm;
+        bz[c++] = vb * sm;
+        bz[c++] = -wb * sm;
+        bz[c++] = -wb * cm;
+      }
+      for (int s = 1; s <= sx; ++s) {
+        const double cs = a.fs[2 * s];
+        const double ss = a.fs[2 * s + 1];
+        for (int n = m; n <= nx; ++n) {
+          const double vb = a.gv[gi(n, m)];
+          const double wb = a.gw[gi(n, m)];
+          bz[c++] = -vb * cm * cs;
+          bz[c++] = vb * sm * cs;
+          bz[c++] = -wb * sm * cs;
+          bz[c++] = -wb * cm * cs;
+          bz[c++] = -vb * cm * ss;
+          bz[c++] = vb * sm * ss;
+          bz[c++] = -wb * sm * ss;
+          bz[c++] = -wb * cm * ss;
+        }
+      }
+    }
+  };
+  block(ord(2), ord(3), ord(4), a.fm);
+  block(ord(5), ord(6), ord(7), a.fl);
+  return static_cast<int>(c);
+}
+
+}  // namespace
+
+int main() {
+  auto raw = hwm14::detail::LoadHwmBinHeader(std::filesystem::path(HWM14_SOURCE_DIR) / "testdata" / "hwm123114.bin");
+  if (!raw) {
+    return EXIT_FAILURE;
+  }
+  const auto& h = raw.value();
+  const auto kernels = hwm14::detail::GeneratedQuietLevelKernels(h);
+  if (kernels.size() != static_cast<std::size_t>(h.nlev + 1)) {
+    return EXIT_FAILURE;
+  }
+
+  const int maxo = std::max({h.maxs, h.maxm, h.maxl});
+  hwm14::detail::AlfState alf;
+  alf.Init(h.maxn, maxo);
+  std::vector<double> gp;
+  std::vector<double> gv;
+  std::vector<double> gw;
+  std::vector<double> fs(static_cast<std::size_t>(2 * (h.maxs + 1)));
+  std::vector<double> fm(static_cast<std::size_t>(2 * (h.maxm + 1)));
+  std::vector<double> fl(static_cast<std::size_t>(2 * (h.maxl + 1)));
+  std::vector<double> sn(static_cast<std::size_t>(h.maxn + 1));
+  std::vector<double> expected(static_cast<std::size_t>(h.nbf));
+  std::vector<double> actual(static_cast<std::size_t>(h.nbf));
+  std::vector<double> tcol(static_cast<std::size_t>(h.nbf));
+  for (std::size_t i = 0; i < tcol.size(); ++i) {
+    tcol[i] = std::cos(0.013 * static_cast<double>(i));
+  }
+
+  for (int trial = 0; trial < 8; ++trial) {
+    const double theta = 0.1 + 0.37 * static_cast<double>(trial);
+    alf.Basis(h.maxn, maxo, theta, gp, gv, gw);
+    for (std::size_t i = 0; i < fs.size(); ++i) {
+      fs[i] = std::cos(0.3 * static_cast<double>(i + static_cast<std::size_t>(trial)));
+    }
+    for (std::size_t i = 0; i < fm.size(); ++i) {
+      fm[i] = std::sin(0.7 * static_cast<double>(i) + static_cast<double>(trial));
+    }
+    for (std::size_t i = 0; i < fl.size(); ++i) {
+      fl[i] = std::cos(1.1 * static_cast<double>(i) - static_cast<double>(trial));
+    }
+    for (std::size_t n = 0; n < sn.size(); ++n) {
+      sn[n] = std::sin(static_cast<double>(n) * theta);
+    }
+    const QuietLevelArgs args{fs.data(), fm.data(), fl.data(), gv.data(), gw.data(), sn.data()};
+
+    for (int d = 0; d <= h.nlev; ++d) {
+      const auto& k = kernels[static_cast<std::size_t>(d)];
+      const int c = ReferenceRow(h, maxo, d, args, expected);
+      if (k.fill(args, actual.data()) != c || k.terms != c ||
+          !std::equal(expected.begin(), expected.begin() + c, actual.begin())) {
+        return EXIT_FAILURE;
+      }
+      double su = 0.0;
+      double sv = 0.0;
+      k.synth(actual.data(), expected.data(), tcol.data(), su, sv);
+      double ru = 0.0;
+      double rv = 0.0;
+      for (int i = 0; i < c; ++i) {
+        ru += actual[static_cast<std::size_t>(i)] * expected[static_cast<std::size_t>(i)];
+        rv += actual[static_cast<std::size_t>(i)] * tcol[static_cast<std::size_t>(i)];
+      }
+      if (su != ru || sv != rv) {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // A changed order table must not match the generated kernels.
+  auto altered = h;
+  altered.order[0] += 1;
+  if (!hwm14::detail::GeneratedQuietLevelKernels(altered).empty()) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
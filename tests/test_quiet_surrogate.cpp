@@ -0,0 +1,125 @@
+// Author: watsonryan
+// Purpose: Validate QuietSurrogate interpolation, error reporting, and exact fallback.
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "hwm14/quiet_surrogate.hpp"
+
+namespace {
+
+bool SameWinds(const hwm14::Winds& a, const hwm14::Winds& b) {
+  return a.zonal_mps == b.zonal_mps && a.meridional_mps == b.meridional_mps;
+}
+
+hwm14::QuietSurrogateSpec SmallSpec() {
+  hwm14::QuietSurrogateSpec spec{};
+  spec.yyddd = 95150;
+  spec.lat_min_deg = -60.0;
+  spec.lat_max_deg = 60.0;
+  spec.lat_step_deg = 5.0;
+  spec.axis_step = 1.0;
+  spec.alt_min_km = 200.0;
+  spec.alt_max_km = 300.0;
+  spec.alt_step_km = 10.0;
+  spec.ut_step_h = 2.0;
+  spec.validation_points = 500;
+  return spec;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto model = hwm14::Model::LoadFromDirectory(dir);
+  if (!model) {
+    return EXIT_FAILURE;
+  }
+  const auto& exact = model.value();
+
+  auto spec = SmallSpec();
+  auto linear = hwm14::QuietSurrogate::Build(exact, spec);
+  spec.interpolation = hwm14::SurrogateInterpolation::kCubic;
+  auto cubic = hwm14::QuietSurrogate::Build(exact, spec);
+  if (!linear || !cubic) {
+    return EXIT_FAILURE;
+  }
+  const auto& lr = linear.value().Report();
+  const auto& cr = cubic.value().Report();
+  if (lr.samples != 500 || cr.samples != 500 || !(lr.rms_mps > 0.0) || !(cr.rms_mps < lr.rms_mps) ||
+      lr.max_mps > 25.0 || cr.max_mps > 10.0) {
+    return EXIT_FAILURE;
+  }
+  // The build-time report is reproducible from its seed.
+  const auto again = linear.value().Validate(500, spec.validation_seed);
+  if (again.rms_mps != lr.rms_mps || again.max_mps != lr.max_mps) {
+    return EXIT_FAILURE;
+  }
+
+  // Lattice nodes reproduce the exact model (the local-time axis places lon at (lt - ut) * 15).
+  hwm14::Inputs in{};
+  in.yyddd = 95150;
+  in.ut_seconds = 4.0 * 3600.0;
+  in.altitude_km = 250.0;
+  in.geodetic_lat_deg = 20.0;
+  in.geodetic_lon_deg = 30.0;  // local time 6 h
+  const auto node = linear.value().QuietWinds(in);
+  const auto ref = exact.QuietWinds(in);
+  if (!node || !ref || !linear.value().Covers(in) || std::abs(node.value().zonal_mps - ref.value().zonal_mps) > 1e-9 ||
+      std::abs(node.value().meridional_mps - ref.value().meridional_mps) > 1e-9) {
+    return EXIT_FAILURE;
+  }
+
+  // Outside the lattice or on another day the exact model answers, bit for bit.
+  std::vector<hwm14::Inputs> outside(3, in);
+  outside[0].geodetic_lat_deg = 70.0;
+  outside[1].altitude_km = 350.0;
+  outside[2].yyddd = 95151;
+  for (const auto& o : outside) {
+    const auto a = linear.value().QuietWinds(o);
+    const auto b = exact.QuietWinds(o);
+    if (linear.value().Covers(o) || !a || !b || !SameWinds(a.value(), b.value())) {
+      return EXIT_FAILURE;
+    }
+  }
+  in.yyddd = 94150;  // same day of year, other year: still covered
+  if (!linear.value().Covers(in)) {
+    return EXIT_FAILURE;
+  }
+
+  // Batch evaluation mixes both paths; invalid rows surface the model's validation error.
+  std::vector<hwm14::Inputs> batch = {in, outside[0], outside[2]};
+  std::vector<hwm14::Winds> out(batch.size());
+  if (!linear.value().QuietWindsBatch(batch, out) || !SameWinds(out[1], exact.QuietWinds(outside[0]).value())) {
+    return EXIT_FAILURE;
+  }
+  batch[2].ut_seconds = std::nan("");
+  if (linear.value().QuietWindsBatch(batch, out)) {
+    return EXIT_FAILURE;
+  }
+
+  // Longitude axis.
+  spec = SmallSpec();
+  spec.axis = hwm14::SurrogateAxis::kLongitude;
+  spec.axis_step = 15.0;
+  auto by_lon = hwm14::QuietSurrogate::Build(exact, spec);
+  if (!by_lon || !(by_lon.value().Report().rms_mps > 0.0) || by_lon.value().LatticeBytes() == 0) {
+    return EXIT_FAILURE;
+  }
+
+  // Steps must divide their ranges.
+  spec = SmallSpec();
+  spec.ut_step_h = 5.0;
+  if (hwm14::QuietSurrogate::Build(exact, spec)) {
+    return EXIT_FAILURE;
+  }
+  spec = SmallSpec();
+  spec.alt_step_km = 30.0;
+  if (hwm14::QuietSurrogate::Build(exact, spec)) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
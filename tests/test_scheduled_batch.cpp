@@ -0,0 +1,95 @@
+// Author: watsonryan
+// Purpose: Validate Model::TotalWindsScheduled against per-row TotalWinds on a shuffled grid batch.
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+// Two epochs of a 10 deg x 30 deg grid at six altitudes, with some quiet-only rows, shuffled.
+std::vector<hwm14::Inputs> ShuffledGrid() {
+  std::vector<hwm14::Inputs> out;
+  for (const double ut : {3600.0, 7200.0}) {
+    for (double lat = -80.0; lat <= 80.0; lat += 10.0) {
+      for (double lon = -180.0; lon < 180.0; lon += 30.0) {
+        for (const double alt : {90.0, 110.0, 150.0, 250.0, 250.0, 400.0}) {
+          const double ap3 = lat > 60.0 ? -1.0 : 20.0;
+          out.push_back({95150, ut, alt, lat, lon, ap3});
+        }
+      }
+    }
+  }
+  std::mt19937 rng(7);
+  std::shuffle(out.begin(), out.end(), rng);
+  return out;
+}
+
+bool MatchesTotalWinds(const hwm14::Model& m, const std::vector<hwm14::Inputs>& in, hwm14::BatchReuseReport& report) {
+  std::vector<hwm14::Winds> out(in.size());
+  const auto r = m.TotalWindsScheduled(in, out);
+  if (!r) {
+    return false;
+  }
+  report = r.value();
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto w = m.TotalWinds(in[i]);
+    if (!w || w.value().meridional_mps != out[i].meridional_mps || w.value().zonal_mps != out[i].zonal_mps) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto model = hwm14::Model::LoadFromDirectory(dir);
+  if (!model) {
+    return EXIT_FAILURE;
+  }
+  const auto& m = model.value();
+
+  const auto batch = ShuffledGrid();
+  hwm14::BatchReuseReport report{};
+  if (!MatchesTotalWinds(m, batch, report) || report.samples != batch.size() || report.epochs != 2) {
+    return EXIT_FAILURE;
+  }
+  // Rows of one level band are visited by latitude, so most keep the ALF basis; rows sharing (lat, lon)
+  // within a band keep the QD transform. Only the first disturbance row of each epoch computes the
+  // subsolar longitude.
+  const auto disturbed = static_cast<std::size_t>(
+      std::count_if(batch.begin(), batch.end(), [](const hwm14::Inputs& in) { return in.ap3 >= 0.0; }));
+  if (report.alf_reuses * 2 < batch.size() || report.qd_reuses == 0 || report.vertical_reuses == 0 ||
+      report.level_reuses * 2 < batch.size() || report.subsolar_reuses != disturbed - 2) {
+    return EXIT_FAILURE;
+  }
+
+  // The float32 coefficient path is scheduled the same way.
+  hwm14::Options single{};
+  single.single_precision = true;
+  auto f32 = hwm14::Model::LoadFromDirectory(dir, single);
+  if (!f32 || !MatchesTotalWinds(f32.value(), batch, report)) {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<hwm14::Winds> out(batch.size());
+  auto invalid = batch;
+  invalid[17].geodetic_lat_deg = 95.0;
+  const auto bad_row = m.TotalWindsScheduled(invalid, out);
+  const auto small = m.TotalWindsScheduled(batch, std::span<hwm14::Winds>(out).first(batch.size() - 1));
+  if (bad_row || bad_row.error().code != hwm14::ErrorCode::kInvalidInput || bad_row.error().detail != "row 17" ||
+      small || small.error().code != hwm14::ErrorCode::kInvalidInput) {
+    return EXIT_FAILURE;
+  }
+  const auto empty = m.TotalWindsScheduled({}, out);
+  if (!empty || empty.value().samples != 0) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
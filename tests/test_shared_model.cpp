@@ -0,0 +1,119 @@
+// Author: watsonryan
+// Purpose: Validate publishing a model to POSIX shared memory and attaching from another process.
+
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#include "hwm14/hwm14.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+hwm14::Inputs SampleInputs() {
+  hwm14::Inputs in{};
+  in.yyddd = 95150;
+  in.ut_seconds = 43200.0;
+  in.altitude_km = 250.0;
+  in.geodetic_lat_deg = -45.0;
+  in.geodetic_lon_deg = -85.0;
+  in.ap3 = 80.0;
+  return in;
+}
+
+}  // namespace
+
+int main() {
+#if defined(__unix__) || defined(__APPLE__)
+  const auto data_dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto model = hwm14::Model::LoadFromDirectory(data_dir);
+  if (!model) {
+    return EXIT_FAILURE;
+  }
+  const auto expected = model.value().TotalWinds(SampleInputs());
+  if (!expected) {
+    return EXIT_FAILURE;
+  }
+
+  const std::string name = "hwm14_test_" + std::to_string(static_cast<long>(::getpid()));
+  if (!model.value().PublishShared(name)) {
+    return EXIT_FAILURE;
+  }
+
+  const std::string shm = "/" + name;
+  const int published = ::shm_open(shm.c_str(), O_RDONLY, 0);
+  struct stat st {};
+  const bool private_mode = published >= 0 && ::fstat(published, &st) == 0 && (st.st_mode & 0777) == 0600;
+  if (published >= 0) {
+    ::close(published);
+  }
+  if (!private_mode) {
+    hwm14::Model::UnlinkShared(name);
+    return EXIT_FAILURE;
+  }
+
+  const pid_t child = ::fork();
+  if (child == 0) {
+    auto attached = hwm14::Model::AttachShared(name);
+    if (!attached) {
+      ::_exit(2);
+    }
+    const auto w = attached.value().TotalWinds(SampleInputs());
+    const bool same = w && w.value().meridional_mps == expected.value().meridional_mps &&
+                      w.value().zonal_mps == expected.value().zonal_mps;
+    ::_exit(same ? 0 : 3);
+  }
+  int status = 0;
+  if (child < 0 || ::waitpid(child, &status, 0) != child || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    hwm14::Model::UnlinkShared(name);
+    return EXIT_FAILURE;
+  }
+
+  hwm14::Options banded{};
+  banded.altitude_band = hwm14::AltitudeBand{100.0, 200.0};
+  const auto rejected = hwm14::Model::AttachShared(name, banded);
+  if (rejected || rejected.error().code != hwm14::ErrorCode::kInvalidInput) {
+    hwm14::Model::UnlinkShared(name);
+    return EXIT_FAILURE;
+  }
+
+  if (!hwm14::Model::UnlinkShared(name)) {
+    return EXIT_FAILURE;
+  }
+  const auto missing = hwm14::Model::AttachShared(name);
+  if (missing || missing.error().code != hwm14::ErrorCode::kDataPathNotFound) {
+    return EXIT_FAILURE;
+  }
+
+  // A sized segment whose magic is not stored yet is a publish in progress.
+  const int pending = ::shm_open(shm.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (pending < 0 || ::ftruncate(pending, 4096) != 0) {
+    return EXIT_FAILURE;
+  }
+  ::close(pending);
+  const auto torn = hwm14::Model::AttachShared(name);
+  hwm14::Model::UnlinkShared(name);
+  if (torn || torn.error().code != hwm14::ErrorCode::kDataFileParseFailed) {
+    return EXIT_FAILURE;
+  }
+
+  hwm14::Options fallback{};
+  fallback.data_dir = data_dir;
+  auto loaded = hwm14::Model::AttachSharedOrLoad(name, fallback);
+  if (!loaded) {
+    return EXIT_FAILURE;
+  }
+  const auto w = loaded.value().TotalWinds(SampleInputs());
+  if (!w || w.value().zonal_mps != expected.value().zonal_mps) {
+    return EXIT_FAILURE;
+  }
+#endif
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+// Author: watsonryan
+// Purpose: Validate Options::single_precision against golden_profiles.csv and the double path.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "golden_scenarios.hpp"
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+// Documented bound on |float32 - double| quiet winds (measured maximum is about 2e-5 m/s).
+constexpr double kSinglePrecisionBoundMps = 1e-4;
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  std::vector<hwm14::test::GoldenRow> rows;
+  hwm14::Options opts{};
+  opts.single_precision = true;
+  auto f32 = hwm14::Model::LoadFromDirectory(dir, opts);
+  auto f64 = hwm14::Model::LoadFromDirectory(dir);
+  if (!hwm14::test::LoadGoldenRows(dir / "golden_profiles.csv", rows) || !f32 || !f64) {
+    return EXIT_FAILURE;
+  }
+
+  int checked = 0;
+  double drift = 0.0;
+  for (const auto& r : rows) {
+    hwm14::Inputs req{};
+    if (!hwm14::test::BuildInputs(r, req)) {
+      return EXIT_FAILURE;
+    }
+    const auto q = f32.value().QuietWinds(req);
+    const auto t = f32.value().TotalWinds(req);
+    const auto ref = f64.value().QuietWinds(req);
+    if (!q || !t || !ref) {
+      return EXIT_FAILURE;
+    }
+    const double tol = hwm14::test::ScenarioTolerance(r.scenario);
+    if (std::abs(q.value().meridional_mps - r.qmer) > tol || std::abs(q.value().zonal_mps - r.qzon) > tol ||
+        std::abs(t.value().meridional_mps - r.tmer) > tol || std::abs(t.value().zonal_mps - r.tzon) > tol) {
+      return EXIT_FAILURE;
+    }
+    drift = std::max({drift, std::abs(q.value().meridional_mps - ref.value().meridional_mps),
+                      std::abs(q.value().zonal_mps - ref.value().zonal_mps)});
+    ++checked;
+  }
+  if (drift > kSinglePrecisionBoundMps) {
+    return EXIT_FAILURE;
+  }
+
+  // Coefficient accessors keep exposing the double coefficients.
+  const auto a = f32.value().QuietZonalCoefficients();
+  const auto b = f64.value().QuietZonalCoefficients();
+  if (a.size() != b.size() || !std::equal(a.begin(), a.end(), b.begin())) {
+    return EXIT_FAILURE;
+  }
+  return checked > 100 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,146 @@
+// Author: watsonryan
+// Purpose: Validate TrackEvaluator drift and refill behavior against exact Model evaluation along a LEO track.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "hwm14/track_evaluator.hpp"
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+// Documented drift bound of the default options.
+constexpr double kDriftBoundMps = 1e-9;
+
+// Circular 51.6 deg orbit at ~400 km sampled every `step_s` seconds, crossing midnight into day 95151.
+std::vector<hwm14::Inputs> Orbit(std::size_t samples, double step_s) {
+  std::vector<hwm14::Inputs> out(samples);
+  const double inc = 51.6 * kPi / 180.0;
+  for (std::size_t i = 0; i < samples; ++i) {
+    const double t = static_cast<double>(i) * step_s;
+    const double u = 2.0 * kPi * t / 5550.0;
+    const double lat = std::asin(std::sin(inc) * std::sin(u));
+    const double lon = std::atan2(std::cos(inc) * std::sin(u), std::cos(u)) - 2.0 * kPi * t / 86164.0;
+    const double ut = 84000.0 + t;
+    auto& in = out[i];
+    in.yyddd = ut < 86400.0 ? 95150 : 95151;
+    in.ut_seconds = std::fmod(ut, 86400.0);
+    in.altitude_km = 400.0 + 15.0 * std::sin(u + 0.3);
+    in.geodetic_lat_deg = lat * 180.0 / kPi;
+    in.geodetic_lon_deg = std::remainder(lon * 180.0 / kPi, 360.0);
+    in.ap3 = 15.0;
+  }
+  return out;
+}
+
+bool Same(const hwm14::Winds& a, const hwm14::Winds& b) {
+  return a.meridional_mps == b.meridional_mps && a.zonal_mps == b.zonal_mps;
+}
+
+// Largest difference from exact `TotalWinds` along `orbit`, or -1 on any evaluation error.
+double MaxTotalDrift(const hwm14::Model& m, hwm14::TrackEvaluator& track, const std::vector<hwm14::Inputs>& orbit) {
+  double max_err = 0.0;
+  for (const auto& in : orbit) {
+    const auto got = track.TotalWinds(in);
+    const auto want = m.TotalWinds(in);
+    if (!got || !want) {
+      return -1.0;
+    }
+    max_err = std::max(max_err, std::hypot(got.value().meridional_mps - want.value().meridional_mps,
+                                           got.value().zonal_mps - want.value().zonal_mps));
+  }
+  return max_err;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto model = hwm14::Model::LoadFromDirectory(dir);
+  if (!model) {
+    return EXIT_FAILURE;
+  }
+  const auto& m = model.value();
+
+  // One-second sampling across midnight: refills every 64 calls plus one at the day change.
+  const auto orbit = Orbit(6000, 1.0);
+  auto track = hwm14::TrackEvaluator::Create(m);
+  if (!track) {
+    return EXIT_FAILURE;
+  }
+  const double drift = MaxTotalDrift(m, track.value(), orbit);
+  const auto& stats = track.value().Stats();
+  if (drift < 0.0 || drift > kDriftBoundMps || stats.evaluations != orbit.size() ||
+      stats.quiet_resyncs < orbit.size() / 64 || stats.quiet_resyncs > orbit.size() / 64 + 3 ||
+      stats.mlt_resyncs > orbit.size() / 64 + 3) {
+    return EXIT_FAILURE;
+  }
+
+  // Coarser sampling still rotates (steps ~0.02 rad) and stays within the bound.
+  auto coarse = hwm14::TrackEvaluator::Create(m);
+  if (!coarse || MaxTotalDrift(m, coarse.value(), Orbit(2000, 20.0)) > kDriftBoundMps ||
+      coarse.value().Stats().quiet_resyncs > 2000 / 64 + 3) {
+    return EXIT_FAILURE;
+  }
+
+  // Refill calls match the exact evaluators bit for bit.
+  hwm14::TrackOptions every{};
+  every.resync_interval = 1;
+  auto exact = hwm14::TrackEvaluator::Create(m, every);
+  if (!exact) {
+    return EXIT_FAILURE;
+  }
+  for (std::size_t i = 0; i < 200; ++i) {
+    const auto q = exact.value().QuietWinds(orbit[i]);
+    const auto t = exact.value().TotalWinds(orbit[i]);
+    const auto wq = m.QuietWinds(orbit[i]);
+    const auto wt = m.TotalWinds(orbit[i]);
+    if (!q || !t || !wq || !wt || !Same(q.value(), wq.value()) || !Same(t.value(), wt.value())) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // A jump larger than max_step_rad, or a Reset, refills immediately.
+  auto jumpy = hwm14::TrackEvaluator::Create(m);
+  if (!jumpy || !jumpy.value().QuietWinds(orbit[0]) || !jumpy.value().QuietWinds(orbit[1])) {
+    return EXIT_FAILURE;
+  }
+  auto far = orbit[2];
+  far.geodetic_lon_deg = std::remainder(far.geodetic_lon_deg + 90.0, 360.0);
+  const auto jumped = jumpy.value().QuietWinds(far);
+  const auto jumped_exact = m.QuietWinds(far);
+  if (!jumped || !jumped_exact || !Same(jumped.value(), jumped_exact.value()) ||
+      jumpy.value().Stats().quiet_resyncs != 2) {
+    return EXIT_FAILURE;
+  }
+  jumpy.value().Reset();
+  const auto after_reset = jumpy.value().QuietWinds(orbit[3]);
+  const auto reset_exact = m.QuietWinds(orbit[3]);
+  if (!after_reset || !reset_exact || !Same(after_reset.value(), reset_exact.value()) ||
+      jumpy.value().Stats().quiet_resyncs != 3) {
+    return EXIT_FAILURE;
+  }
+
+  hwm14::TrackOptions zero_interval{};
+  zero_interval.resync_interval = 0;
+  hwm14::TrackOptions wide_step{};
+  wide_step.max_step_rad = 0.5;
+  hwm14::TrackOptions nan_step{};
+  nan_step.max_step_rad = std::nan("");
+  for (const auto& opts : {zero_interval, wide_step, nan_step}) {
+    const auto bad = hwm14::TrackEvaluator::Create(m, opts);
+    if (bad || bad.error().code != hwm14::ErrorCode::kInvalidInput) {
+      return EXIT_FAILURE;
+    }
+  }
+  auto invalid = orbit[0];
+  invalid.geodetic_lat_deg = 95.0;
+  const auto rejected = track.value().TotalWinds(invalid);
+  if (rejected || rejected.error().code != hwm14::ErrorCode::kInvalidInput) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
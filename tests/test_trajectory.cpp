@@ -0,0 +1,134 @@
+// Author: watsonryan
+// Purpose: Validate Model::EvaluateTrajectory against exact TotalWinds along a LEO-like orbit.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Circular 51.6 deg orbit at ~400 km sampled every second, starting late on day 95150 so it crosses
+// midnight into day 95151.
+std::vector<hwm14::Inputs> Orbit(std::size_t samples) {
+  std::vector<hwm14::Inputs> out(samples);
+  const double inc = 51.6 * kPi / 180.0;
+  for (std::size_t i = 0; i < samples; ++i) {
+    const double t = static_cast<double>(i);
+    const double u = 2.0 * kPi * t / 5550.0;
+    const double lat = std::asin(std::sin(inc) * std::sin(u));
+    const double lon = std::atan2(std::cos(inc) * std::sin(u), std::cos(u)) - 2.0 * kPi * t / 86164.0;
+    const double ut = 84000.0 + t;
+    auto& in = out[i];
+    in.yyddd = ut < 86400.0 ? 95150 : 95151;
+    in.ut_seconds = std::fmod(ut, 86400.0);
+    in.altitude_km = 400.0 + 15.0 * std::sin(u + 0.3);
+    in.geodetic_lat_deg = lat * 180.0 / kPi;
+    in.geodetic_lon_deg = std::remainder(lon * 180.0 / kPi, 360.0);
+    in.ap3 = 15.0;
+  }
+  return out;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto model = hwm14::Model::LoadFromDirectory(dir);
+  if (!model) {
+    return EXIT_FAILURE;
+  }
+  const auto& m = model.value();
+
+  const auto orbit = Orbit(6000);
+  hwm14::TrajectoryOptions opts{};
+  opts.tolerance_mps = 0.2;
+  std::vector<hwm14::Winds> out(orbit.size());
+  const auto report = m.EvaluateTrajectory(orbit, out, opts);
+  if (!report || report.value().samples != orbit.size() || report.value().segments != 2 ||
+      report.value().max_check_error_mps > opts.tolerance_mps) {
+    return EXIT_FAILURE;
+  }
+  // At least 10x fewer exact evaluations than samples on a smooth orbit.
+  if (report.value().exact_evaluations * 10 > orbit.size() || report.value().knots > report.value().exact_evaluations) {
+    return EXIT_FAILURE;
+  }
+
+  double max_err = 0.0;
+  for (std::size_t i = 0; i < orbit.size(); ++i) {
+    const auto w = m.TotalWinds(orbit[i]);
+    if (!w) {
+      return EXIT_FAILURE;
+    }
+    max_err = std::max(max_err, std::hypot(out[i].meridional_mps - w.value().meridional_mps,
+                                           out[i].zonal_mps - w.value().zonal_mps));
+    // Segment ends are knots, so the last sample of day 95150 and the first of 95151 are exact.
+    const bool boundary = i == 0 || i + 1 == orbit.size() || orbit[i].yyddd != orbit[i - 1].yyddd ||
+                          (i + 1 < orbit.size() && orbit[i].yyddd != orbit[i + 1].yyddd);
+    if (boundary && (out[i].meridional_mps != w.value().meridional_mps || out[i].zonal_mps != w.value().zonal_mps)) {
+      return EXIT_FAILURE;
+    }
+  }
+  // Only check samples are verified; between them the error stays within a small multiple of the tolerance.
+  if (max_err > 2.0 * opts.tolerance_mps) {
+    return EXIT_FAILURE;
+  }
+
+  // A zero tolerance falls back to exact evaluation of every sample.
+  const std::vector<hwm14::Inputs> head(orbit.begin(), orbit.begin() + 64);
+  hwm14::TrajectoryOptions strict{};
+  strict.tolerance_mps = 0.0;
+  strict.initial_knot_stride = 8;
+  std::vector<hwm14::Winds> head_out(head.size());
+  const auto exact = m.EvaluateTrajectory(head, head_out, strict);
+  if (!exact || exact.value().exact_evaluations != head.size()) {
+    return EXIT_FAILURE;
+  }
+
+  // An ap3 step starts a new segment.
+  auto stepped = head;
+  for (std::size_t i = 32; i < stepped.size(); ++i) {
+    stepped[i].ap3 = 80.0;
+  }
+  const auto split = m.EvaluateTrajectory(stepped, head_out);
+  if (!split || split.value().segments != 2) {
+    return EXIT_FAILURE;
+  }
+
+  // Crossing the century (99365 -> 00001) keeps time increasing.
+  auto century = head;
+  for (std::size_t i = 0; i < century.size(); ++i) {
+    century[i].yyddd = i < 32 ? 99365 : 1;
+    century[i].ut_seconds = std::fmod(86368.0 + static_cast<double>(i), 86400.0);
+  }
+  const auto wrapped = m.EvaluateTrajectory(century, head_out);
+  if (!wrapped || wrapped.value().segments != 2) {
+    return EXIT_FAILURE;
+  }
+
+  auto unordered = head;
+  unordered[10].ut_seconds = unordered[9].ut_seconds;
+  auto invalid = head;
+  invalid[5].geodetic_lat_deg = 95.0;
+  std::vector<hwm14::Winds> small(head.size() - 1);
+  hwm14::TrajectoryOptions no_stride{};
+  no_stride.initial_knot_stride = 0;
+  const auto e1 = m.EvaluateTrajectory(unordered, head_out);
+  const auto e2 = m.EvaluateTrajectory(invalid, head_out);
+  const auto e3 = m.EvaluateTrajectory(head, small);
+  const auto e4 = m.EvaluateTrajectory(head, head_out, no_stride);
+  for (const auto* e : {&e1, &e2, &e3, &e4}) {
+    if (*e || e->error().code != hwm14::ErrorCode::kInvalidInput) {
+      return EXIT_FAILURE;
+    }
+  }
+  if (e1.error().detail != "row 10" || e2.error().detail != "row 5") {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
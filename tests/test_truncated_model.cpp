@@ -0,0 +1,186 @@
+// Author: watsonryan
+// Purpose: Validate Model::WithTruncation layouts and its accuracy on the golden_profiles.csv scenarios.
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+#include "golden_scenarios.hpp"
+#include "hwm14/detail/hwm_bin_loader.hpp"
+#include "hwm14/hwm14.hpp"
+
+namespace {
+
+// Measured golden-scenario differences of the preset below are rms 16.1 / max 47.6 m/s.
+constexpr double kPresetRmsBoundMps = 20.0;
+constexpr double kPresetMaxBoundMps = 70.0;
+
+bool LoadGoldenInputs(const std::filesystem::path& csv_path, std::vector<hwm14::Inputs>& out) {
+  std::vector<hwm14::test::GoldenRow> rows;
+  if (!hwm14::test::LoadGoldenRows(csv_path, rows)) {
+    return false;
+  }
+  for (const auto& r : rows) {
+    hwm14::Inputs in{};
+    if (!hwm14::test::BuildInputs(r, in)) {
+      return false;
+    }
+    out.push_back(in);
+  }
+  return out.size() > 100;
+}
+
+bool Identical(const hwm14::Model& a, const hwm14::Model& b, const std::vector<hwm14::Inputs>& in) {
+  const auto d = a.CompareQuietWinds(b, in);
+  return d && d.value().samples == in.size() && d.value().max_mps == 0.0;
+}
+
+// Dense design rows dotted with the (rebuilt) coefficient columns must reproduce QuietWinds.
+bool DesignConsistent(const hwm14::Model& m, const std::vector<hwm14::Inputs>& in) {
+  const std::size_t cols = m.QuietDesignColumns();
+  std::vector<double> rows(in.size() * cols);
+  if (!m.QuietDesignMatrixDense(in, rows)) {
+    return false;
+  }
+  const auto mz = m.QuietZonalCoefficients();
+  const auto mm = m.QuietMeridionalCoefficients();
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    double u = 0.0;
+    double v = 0.0;
+    for (std::size_t k = 0; k < cols; ++k) {
+      u += rows[i * cols + k] * mz[k];
+      v += rows[i * cols + k] * mm[k];
+    }
+    const auto w = m.QuietWinds(in[i]);
+    if (!w || std::abs(w.value().zonal_mps - u) > 1e-9 || std::abs(w.value().meridional_mps - v) > 1e-9) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// `m` with `raw_mparm` added as its only ensemble member evaluates that member exactly as `m` itself.
+bool MembersMatch(const hwm14::Model& m, const std::vector<double>& raw_mparm, const std::vector<hwm14::Inputs>& in) {
+  auto ens = m.WithEnsembleMembers({raw_mparm});
+  std::vector<hwm14::Winds> members(in.size());
+  if (!ens || !ens.value().QuietWindsEnsemble(in, members)) {
+    return false;
+  }
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto w = m.QuietWinds(in[i]);
+    if (!w || w.value().zonal_mps != members[i].zonal_mps || w.value().meridional_mps != members[i].meridional_mps) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+int main() {
+  const auto dir = std::filesystem::path(HWM14_SOURCE_DIR) / "testdata";
+  auto model = hwm14::Model::LoadFromDirectory(dir);
+  std::vector<hwm14::Inputs> golden;
+  if (!model || !LoadGoldenInputs(dir / "golden_profiles.csv", golden)) {
+    return EXIT_FAILURE;
+  }
+  const auto& full = model.value();
+
+  // No caps, and a threshold below every nonzero magnitude, leave the model unchanged.
+  auto noop = full.WithTruncation({});
+  hwm14::QuietTruncation zeros{};
+  zeros.coefficient_threshold = 1e-300;
+  auto zero_only = full.WithTruncation(zeros);
+  if (!noop || !zero_only || noop.value().QuietActiveTerms() != full.QuietActiveTerms() ||
+      !Identical(noop.value(), full, golden) || !Identical(zero_only.value(), full, golden)) {
+    return EXIT_FAILURE;
+  }
+
+  hwm14::QuietTruncation preset{};
+  preset.max_planetary_wave = 1;
+  preset.max_seasonal = 1;
+  auto reduced = full.WithTruncation(preset);
+  if (!reduced || reduced.value().QuietActiveTerms() >= full.QuietActiveTerms() / 2) {
+    return EXIT_FAILURE;
+  }
+  const auto report = reduced.value().CompareQuietWinds(full, golden);
+  if (!report || report.value().samples != golden.size() || !(report.value().rms_mps > 0.0) ||
+      report.value().rms_mps > kPresetRmsBoundMps || report.value().max_mps > kPresetMaxBoundMps) {
+    return EXIT_FAILURE;
+  }
+  if (!DesignConsistent(reduced.value(), golden)) {
+    return EXIT_FAILURE;
+  }
+  // Truncating again with the same caps changes nothing.
+  auto again = reduced.value().WithTruncation(preset);
+  if (!again || again.value().QuietActiveTerms() != reduced.value().QuietActiveTerms() ||
+      !Identical(again.value(), reduced.value(), golden)) {
+    return EXIT_FAILURE;
+  }
+
+  // Thresholding drops terms, and the compact layout still matches the basis loops.
+  hwm14::QuietTruncation thresholded{};
+  thresholded.coefficient_threshold = 2.0;
+  auto sparse = full.WithTruncation(thresholded);
+  if (!sparse || sparse.value().QuietActiveTerms() >= full.QuietActiveTerms() ||
+      !DesignConsistent(sparse.value(), golden)) {
+    return EXIT_FAILURE;
+  }
+
+  // Ensemble members are truncated with the base coefficients.
+  auto raw = hwm14::detail::LoadHwmBinHeader(dir / "hwm123114.bin");
+  if (!raw) {
+    return EXIT_FAILURE;
+  }
+  auto ens = full.WithEnsembleMembers({raw.value().mparm});
+  if (!ens) {
+    return EXIT_FAILURE;
+  }
+  auto ens_reduced = ens.value().WithTruncation(preset);
+  if (!ens_reduced) {
+    return EXIT_FAILURE;
+  }
+  std::vector<hwm14::Winds> members(golden.size());
+  if (!ens_reduced.value().QuietWindsEnsemble(golden, members)) {
+    return EXIT_FAILURE;
+  }
+  for (std::size_t i = 0; i < golden.size(); ++i) {
+    const auto w = reduced.value().QuietWinds(golden[i]);
+    if (!w || w.value().zonal_mps != members[i].zonal_mps || w.value().meridional_mps != members[i].meridional_mps) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Raw members added after truncation are split with the loaded order table and truncated likewise.
+  if (!MembersMatch(reduced.value(), raw.value().mparm, golden)) {
+    return EXIT_FAILURE;
+  }
+
+  // A truncated model round-trips through a blob.
+  const auto tmp = std::filesystem::temp_directory_path() / "hwm14_truncated_model";
+  std::error_code ec;
+  std::filesystem::remove_all(tmp, ec);
+  std::filesystem::create_directories(tmp, ec);
+  if (ec || !reduced.value().SaveBlob(tmp / "reduced.blob")) {
+    return EXIT_FAILURE;
+  }
+  auto blob = hwm14::Model::LoadFromBlob(tmp / "reduced.blob");
+  std::filesystem::remove_all(tmp, ec);
+  if (!blob || !Identical(blob.value(), reduced.value(), golden) ||
+      !MembersMatch(blob.value(), raw.value().mparm, golden)) {
+    return EXIT_FAILURE;
+  }
+
+  hwm14::QuietTruncation negative{};
+  negative.max_tide = -1;
+  hwm14::QuietTruncation nan_threshold{};
+  nan_threshold.coefficient_threshold = std::nan("");
+  const auto bad_cap = full.WithTruncation(negative);
+  const auto bad_threshold = full.WithTruncation(nan_threshold);
+  if (bad_cap || bad_cap.error().code != hwm14::ErrorCode::kInvalidInput || bad_threshold ||
+      bad_threshold.error().code != hwm14::ErrorCode::kInvalidInput) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
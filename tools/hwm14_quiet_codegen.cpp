@@ -0,0 +1,180 @@
+// Author: watsonryan
+// Purpose: Emit straight-line quiet-wind level kernels from the order table of an hwm123114.bin file.
+//
+// Usage: hwm14_quiet_codegen <hwm123114.bin> <out.cpp>
+//
+// Each level's loops over (amaxs, amaxn, pmaxm, pmaxs, pmaxn, tmaxl, tmaxs, tmaxn) are expanded into
+// one assignment per basis term, using the same expressions and evaluation order as
+// `FillQuietLevelBasis`, so the generated kernels are bit-identical to the generic path.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "hwm14/detail/hwm_bin_loader.hpp"
+
+namespace {
+
+using hwm14::detail::HwmBinHeader;
+
+int Order(const HwmBinHeader& h, int c0, int d) {
+  return h.order[static_cast<std::size_t>(c0) + static_cast<std::size_t>(h.ncomp) * static_cast<std::size_t>(d)];
+}
+
+// Emits the fill function of level `d` and returns its term count.
+int EmitLevelFill(std::ostream& os, const HwmBinHeader& h, int maxo, int d) {
+  const int amaxs = Order(h, 0, d);
+  const int amaxn = Order(h, 1, d);
+  const int pmaxm = Order(h, 2, d);
+  const int pmaxs = Order(h, 3, d);
+  const int pmaxn = Order(h, 4, d);
+  const int tmaxl = Order(h, 5, d);
+  const int tmaxs = Order(h, 6, d);
+  const int tmaxn = Order(h, 7, d);
+  const auto gi = [maxo](int n, int m) { return n * (maxo + 1) + m; };
+
+  os << "int QuietLevelFill" << d << "([[maybe_unused]] const QuietLevelArgs& a, [[maybe_unused]] double* bz) {\n";
+  for (int n = 1; n <= amaxn; ++n) {
+    os << "  const double sn" << n << " = a.sn[" << n << "];\n";
+  }
+  const int smax = std::max({amaxn > 0 ? amaxs : 0, pmaxm > 0 ? pmaxs : 0, tmaxl > 0 ? tmaxs : 0});
+  for (int s = 1; s <= smax; ++s) {
+    os << "  const double cs" << s << " = a.fs[" << 2 * s << "];\n";
+    os << "  const double ss" << s << " = a.fs[" << 2 * s + 1 << "];\n";
+  }
+  // The generic wave/tide factors are 1.0 for every m, l >= 1, so they are exact no-ops here.
+  for (int m = 1; m <= pmaxm; ++m) {
+    os << "  const double cm" << m << " = a.fm[" << 2 * m << "];\n";
+    os << "  const double sm" << m << " = a.fm[" << 2 * m + 1 << "];\n";
+  }
+  for (int l = 1; l <= tmaxl; ++l) {
+    os << "  const double cl" << l << " = a.fl[" << 2 * l << "];\n";
+    os << "  const double sl" << l << " = a.fl[" << 2 * l + 1 << "];\n";
+  }
+
+  int c = 0;
+  const auto put = [&os, &c](const std::string& expr) { os << "  bz[" << c++ << "] = " << expr << ";\n"; };
+  for (int n = 1; n <= amaxn; ++n) {
+    const std::string sc = "sn" + std::to_string(n);
+    put("-" + sc);
+    put(sc);
+  }
+  for (int s = 1; s <= amaxs; ++s) {
+    const std::string cs = "cs" + std::to_string(s);
+    const std::string ss = "ss" + std::to_string(s);
+    for (int n = 1; n <= amaxn; ++n) {
+      const std::string sc = "sn" + std::to_string(n);
+      put("-" + sc + " * " + cs);
+      put(sc + " * " + ss);
+      put(sc + " * " + cs);
+      put("-" + sc + " * " + ss);
+    }
+  }
+
+  // Wave (m, pmax*) and tide (l, tmax*) blocks share the same term pattern.
+  const auto harmonic_block = [&](int mx, int maxs_k, int maxn_k, const char* cname, const char* sname) {
+    for (int m = 1; m <= mx; ++m) {
+      const std::string cm = cname + std::to_string(m);
+      const std::string sm = sname + std::to_string(m);
+      for (int n = m; n <= maxn_k; ++n) {
+        const std::string vb = "a.gv[" + std::to_string(gi(n, m)) + "]";
+        const std::string wb = "a.gw[" + std::to_string(gi(n, m)) + "]";
+        put("-" + vb + " * " + cm);
+        put(vb + " * " + sm);
+        put("-" + wb + " * " + sm);
+        put("-" + wb + " * " + cm);
+      }
+      for (int s = 1; s <= maxs_k; ++s) {
+        const std::string cs = "cs" + std::to_string(s);
+        const std::string ss = "ss" + std::to_string(s);
+        for (int n = m; n <= maxn_k; ++n) {
+          const std::string vb = "a.gv[" + std::to_string(gi(n, m)) + "]";
+          const std::string wb = "a.gw[" + std::to_string(gi(n, m)) + "]";
+          put("-" + vb + " * " + cm + " * " + cs);
+          put(vb + " * " + sm + " * " + cs);
+          put("-" + wb + " * " + sm + " * " + cs);
+          put("-" + wb + " * " + cm + " * " + cs);
+          put("-" + vb + " * " + cm + " * " + ss);
+          put(vb + " * " + sm + " * " + ss);
+          put("-" + wb + " * " + sm + " * " + ss);
+          put("-" + wb + " * " + cm + " * " + ss);
+        }
+      }
+    }
+  };
+  harmonic_block(pmaxm, pmaxs, pmaxn, "cm", "sm");
+  harmonic_block(tmaxl, tmaxs, tmaxn, "cl", "sl");
+
+  os << "  return " << c << ";\n}\n\n";
+  return c;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    std::cerr << "usage: hwm14_quiet_codegen <hwm123114.bin> <out.cpp>\n";
+    return EXIT_FAILURE;
+  }
+  auto parsed = hwm14::detail::LoadHwmBinHeader(argv[1]);
+  if (!parsed) {
+    std::cerr << "hwm14_quiet_codegen: " << parsed.error().message << " (" << parsed.error().detail << ")\n";
+    return EXIT_FAILURE;
+  }
+  const HwmBinHeader& h = parsed.value();
+  const int maxo = std::max({h.maxs, h.maxm, h.maxl});
+  const int levels = h.nlev + 1;
+
+  std::ostringstream os;
+  os << "// Generated by tools/hwm14_quiet_codegen.cpp -- do not edit.\n\n"
+     << "#include <algorithm>\n#include <array>\n#include <cmath>\n#include <cstdint>\n\n"
+     << "#include \"hwm14/detail/quiet_level_kernels.hpp\"\n\n"
+     << "namespace hwm14::detail {\n\nnamespace {\n\n"
+     << "template <int C>\n"
+     << "void QuietLevelSynth(const double* bz, const double* mcol, const double* tcol, double& su, double& sv) {\n"
+     << "  double u = 0.0;\n  double v = 0.0;\n"
+     << "  for (int k = 0; k < C; ++k) {\n    u += bz[k] * mcol[k];\n    v += bz[k] * tcol[k];\n  }\n"
+     << "  su = u;\n  sv = v;\n}\n\n";
+
+  std::string table;
+  for (int d = 0; d < levels; ++d) {
+    const int terms = EmitLevelFill(os, h, maxo, d);
+    if (terms > h.nbf) {
+      std::cerr << "hwm14_quiet_codegen: level " << d << " has more terms than nbf\n";
+      return EXIT_FAILURE;
+    }
+    table += "    QuietLevelKernel{&QuietLevelFill" + std::to_string(d) + ", &QuietLevelSynth<" + std::to_string(terms) +
+             ">, " + std::to_string(terms) + "},\n";
+  }
+
+  os << "constexpr std::array<std::int32_t, 7> kDims = {" << h.nbf << ", " << h.maxs << ", " << h.maxm << ", "
+     << h.maxl << ", " << h.maxn << ", " << h.ncomp << ", " << h.nlev << "};\n\n";
+  os << "constexpr std::array<std::int32_t, " << h.ncomp * levels << "> kOrder = {";
+  for (int i = 0; i < h.ncomp * levels; ++i) {
+    os << (i % 18 == 0 ? "\n    " : " ") << h.order[static_cast<std::size_t>(i)] << ",";
+  }
+  os << "\n};\n\n";
+  os << "constexpr std::array<QuietLevelKernel, " << levels << "> kLevels = {{\n" << table << "}};\n\n"
+     << "}  // namespace\n\n"
+     << "std::span<const QuietLevelKernel> GeneratedQuietLevelKernels(const HwmBinHeader& h) {\n"
+     << "  const std::array<std::int32_t, 7> dims = {h.nbf, h.maxs, h.maxm, h.maxl, h.maxn, h.ncomp, h.nlev};\n"
+     << "  if (dims != kDims || h.order.size() < kOrder.size() ||\n"
+     << "      !std::equal(kOrder.begin(), kOrder.end(), h.order.begin())) {\n"
+     << "    return {};\n  }\n"
+     << "  return kLevels;\n}\n\n"
+     << "}  // namespace hwm14::detail\n";
+
+  const std::filesystem::path out_path(argv[2]);
+  std::ofstream out(out_path, std::ios::binary | std::ios::trunc);
+  out << os.str();
+  if (!out) {
+    std::cerr << "hwm14_quiet_codegen: failed to write " << out_path << "\n";
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}